@@ -0,0 +1,145 @@
+// MIT License
+// 
+// Copyright (c) 2018-2019 Nuraga Wiswakarma
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "JavascriptExtCallbackReplay.generated.h"
+
+class UJavascriptExtTreeView;
+class UWidget;
+
+USTRUCT(BlueprintType)
+struct FJavascriptExtReplayStats
+{
+	GENERATED_BODY()
+
+	/** Number of refresh, expansion, selection and scroll steps that ticked the view */
+	UPROPERTY(BlueprintReadOnly, Category = "Javascript")
+	int32 NumSteps;
+
+	/** Rows and cells generated during the replay */
+	UPROPERTY(BlueprintReadOnly, Category = "Javascript")
+	int32 NumRowsGenerated;
+
+	/** Rows and cells generated in the recorded session */
+	UPROPERTY(BlueprintReadOnly, Category = "Javascript")
+	int32 NumRowsRecorded;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Javascript")
+	int32 NumGetChildren;
+
+	/** Time spent ticking the view, excluding the replay bookkeeping */
+	UPROPERTY(BlueprintReadOnly, Category = "Javascript")
+	float TotalSeconds;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Javascript")
+	float MaxStepSeconds;
+
+	FJavascriptExtReplayStats()
+	: NumSteps(0)
+	, NumRowsGenerated(0)
+	, NumRowsRecorded(0)
+	, NumGetChildren(0)
+	, TotalSeconds(0)
+	, MaxStepSeconds(0)
+	{
+	}
+};
+
+/**
+* Stand-in for a recorded item.
+*/
+UCLASS(BlueprintType)
+class JAVASCRIPTEXTUMG_API UJavascriptExtReplayItem : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(BlueprintReadOnly, Category = "Javascript")
+	int32 RecordedId;
+
+	/** Name of the object this item stood for while recording */
+	UPROPERTY(BlueprintReadOnly, Category = "Javascript")
+	FString RecordedName;
+};
+
+/**
+* Feeds a recorded callback stream into a tree or list view through native stub delegates,
+* so refresh and scroll work can be measured without the script application.
+*/
+UCLASS(BlueprintType)
+class JAVASCRIPTEXTUMG_API UJavascriptExtCallbackReplay : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	/** Loads a recording saved with UJavascriptExtTreeView::SaveRecording */
+	UFUNCTION(BlueprintCallable, Category = "Javascript")
+	bool LoadRecording(const FString& Filename);
+
+	/** Binds stub delegates to the view, replays every recorded step and ticks the view at the given size */
+	UFUNCTION(BlueprintCallable, Category = "Javascript")
+	FJavascriptExtReplayStats Replay(UJavascriptExtTreeView* View, FVector2D ViewSize);
+
+	UFUNCTION()
+	UWidget* HandleGenerateRow(UObject* Object, FName Id, UJavascriptExtTreeView* Instance);
+
+	UFUNCTION()
+	void HandleGetChildren(UObject* Item, UJavascriptExtTreeView* Instance);
+
+protected:
+
+	struct FReplayEvent
+	{
+		TCHAR Type;
+		int32 Item;
+		double Value;
+		TArray<int32> Items;
+		TArray<FName> Columns;
+		TArray<float> Widths;
+	};
+
+	/** Applies the children recorded between the given event and the next step that ticks the view */
+	void ApplyChildren(int32 FirstEventIndex);
+
+	UObject* GetReplayItem(int32 Id) const;
+	void GetReplayItems(const TArray<int32>& Ids, TArray<UObject*>& OutItems) const;
+	void SetColumns(UJavascriptExtTreeView* View, const FReplayEvent& Event);
+	void TickView(UJavascriptExtTreeView* View, const FVector2D& ViewSize);
+
+	TArray<FReplayEvent> Events;
+
+	/** Recorded names by item id */
+	TArray<FString> ItemNames;
+
+	UPROPERTY(Transient)
+	TArray<UJavascriptExtReplayItem*> ReplayItems;
+
+	/** Children last recorded for every item id */
+	TMap<int32, TArray<int32>> ReplayChildren;
+
+	FJavascriptExtReplayStats Stats;
+
+	double CurrentTime;
+};
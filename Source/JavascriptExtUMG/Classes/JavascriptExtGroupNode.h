@@ -0,0 +1,65 @@
+// MIT License
+// 
+// Copyright (c) 2018-2019 Nuraga Wiswakarma
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "JavascriptExtGroupNode.generated.h"
+
+/**
+* Synthetic tree node holding the items that share a group key.
+*/
+UCLASS(BlueprintType)
+class JAVASCRIPTEXTUMG_API UJavascriptExtGroupNode : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	/** Exported value of the grouped property shared by every item in this group */
+	UPROPERTY(BlueprintReadOnly, Category = "Javascript")
+	FString Key;
+
+	/** Property path this group was bucketed by */
+	UPROPERTY(BlueprintReadOnly, Category = "Javascript")
+	FString GroupBy;
+
+	/** Nesting level, 0 for top level groups */
+	UPROPERTY(BlueprintReadOnly, Category = "Javascript")
+	int32 Depth;
+
+	/** Number of items in this group and its nested groups */
+	UPROPERTY(BlueprintReadOnly, Category = "Javascript")
+	int32 Count;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Javascript")
+	UJavascriptExtGroupNode* Parent;
+
+	/** Nested groups, or the grouped items for the innermost level */
+	UPROPERTY(BlueprintReadOnly, Category = "Javascript")
+	TArray<UObject*> Children;
+
+	TMap<FString, UJavascriptExtGroupNode*> SubGroups;
+
+	UFUNCTION(BlueprintCallable, Category = "Javascript")
+	FText GetDisplayText() const;
+};
@@ -0,0 +1,139 @@
+// MIT License
+// 
+// Copyright (c) 2018-2019 Nuraga Wiswakarma
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GenericPlatformFile.h"
+#include "Async/MappedFileHandle.h"
+#include "Future.h"
+#include "ThreadSafeBool.h"
+#include "JavascriptExtLineSource.generated.h"
+
+/**
+* Memory-maps a text file and indexes its line offsets on a background thread.
+* Line text is only decoded when requested, so views only pay for visible rows.
+*/
+UCLASS(BlueprintType)
+class JAVASCRIPTEXTUMG_API UJavascriptExtLineSource : public UObject
+{
+	GENERATED_UCLASS_BODY()
+
+public:
+	/** Delegate fired on the game thread whenever the number of indexed lines changes */
+	DECLARE_MULTICAST_DELEGATE_OneParam(FOnLinesIndexed, UJavascriptExtLineSource*);
+
+	/** Field delimiter used to split lines into columns, empty disables the split */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Javascript")
+	FString Delimiter;
+
+	/** Keeps watching the file and indexes lines appended after it was opened */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Javascript")
+	bool bFollowTail;
+
+	/** Seconds between checks for index progress and appended data */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Javascript")
+	float PollInterval;
+
+	UFUNCTION(BlueprintCallable, Category = "Javascript")
+	bool Open(const FString& InFilename);
+
+	UFUNCTION(BlueprintCallable, Category = "Javascript")
+	void Close();
+
+	UFUNCTION(BlueprintCallable, Category = "Javascript")
+	int32 GetNumLines() const;
+
+	UFUNCTION(BlueprintCallable, Category = "Javascript")
+	bool IsIndexing() const;
+
+	UFUNCTION(BlueprintCallable, Category = "Javascript")
+	FString GetLine(int32 LineIndex) const;
+
+	UFUNCTION(BlueprintCallable, Category = "Javascript")
+	FString GetField(int32 LineIndex, int32 FieldIndex) const;
+
+	UFUNCTION(BlueprintCallable, Category = "Javascript")
+	void GetFields(int32 LineIndex, TArray<FString>& OutFields) const;
+
+	FOnLinesIndexed OnLinesIndexed;
+
+	// UObject interface
+	virtual void BeginDestroy() override;
+	// End of UObject interface
+
+protected:
+
+	bool MapFile();
+	void StartIndexing();
+	void IndexRange(const uint8* Data, int64 Size, bool bIndexPartialTail);
+	void ResetIndex();
+	bool HandleTicker(float DeltaTime);
+	bool GetLineRange(int32 LineIndex, int64& OutStart, int64& OutEnd) const;
+
+	FString Filename;
+
+	TUniquePtr<IMappedFileHandle> MappedHandle;
+	TUniquePtr<IMappedFileRegion> MappedRegion;
+
+	/** Start offset of every indexed line, guarded by IndexLock */
+	TArray<int64> LineStarts;
+
+	/** End offset of the indexed range, guarded by IndexLock */
+	int64 IndexedBytes;
+
+	/** Whether the last indexed line has no line break yet, guarded by IndexLock */
+	bool bPartialTail;
+
+	mutable FCriticalSection IndexLock;
+
+	TFuture<void> IndexTask;
+
+	FThreadSafeBool bCancelIndexing;
+
+	int32 NotifiedLines;
+
+	FDelegateHandle TickerHandle;
+};
+
+/**
+* Row proxy handed to list views fed by a UJavascriptExtLineSource.
+*/
+UCLASS(BlueprintType)
+class JAVASCRIPTEXTUMG_API UJavascriptExtLineItem : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(BlueprintReadOnly, Category = "Javascript")
+	UJavascriptExtLineSource* Source;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Javascript")
+	int32 LineIndex;
+
+	UFUNCTION(BlueprintCallable, Category = "Javascript")
+	FString GetText() const;
+
+	UFUNCTION(BlueprintCallable, Category = "Javascript")
+	FString GetField(int32 FieldIndex) const;
+};
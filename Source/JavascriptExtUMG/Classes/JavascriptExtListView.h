@@ -27,6 +27,7 @@
 #include "JavascriptExtListView.generated.h"
 
 class UJavascriptContext;
+class UJavascriptExtLineSource;
 
 /**
 * Allows thousands of items to be displayed in a list.  Generates widgets dynamically for each item.
@@ -41,6 +42,21 @@ public:
 	UPROPERTY(EditAnywhere, Category = Content)
 	float ItemHeight;
 
+	/** Number of row proxies kept around the visible lines while a line source feeds the list */
+	UPROPERTY(EditAnywhere, Category = Content)
+	int32 LineWindowSize;
+
+	/**
+	* Number of newest Items kept by AppendItem, 0 keeps Items unbounded. The oldest are evicted in one batch once
+	* Items exceeds this by an eighth, so each append costs amortized O(1) and Items holds at most 1.125x ItemCapacity
+	*/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Content)
+	int32 ItemCapacity;
+
+	/** Native line source feeding the list by row index, Items only holds a window of row proxies while set */
+	UPROPERTY(BlueprintReadOnly, Transient, Category = "Javascript")
+	UJavascriptExtLineSource* LineSource;
+
 	/** Event fired when a tutorial stage ends */
 	UFUNCTION(BlueprintImplementableEvent, Category = "Javascript")
 	void OnClick(UObject* Object);
@@ -55,9 +71,73 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Behavior")
 	void SetSelection(UObject* SoleSelectedItem);
 
+	/** Queues an item to be appended to Items on the next frame, evicting the oldest past ItemCapacity */
+	UFUNCTION(BlueprintCallable, Category = "Behavior")
+	void AppendItem(UObject* Item);
+
+	UFUNCTION(BlueprintCallable, Category = "Behavior")
+	void AppendItems(const TArray<UObject*>& InItems);
+
+	/** Applies queued appends and evictions right away instead of waiting for the next frame */
+	UFUNCTION(BlueprintCallable, Category = "Behavior")
+	void FlushAppendedItems();
+
+	/** Feeds the list from a line source, or restores the plain Items behavior when null */
+	UFUNCTION(BlueprintCallable, Category = "Behavior")
+	void SetLineSource(UJavascriptExtLineSource* InLineSource);
+
+	/** Scrolls a line source backed list so the given line is the first visible row */
+	UFUNCTION(BlueprintCallable, Category = "Behavior")
+	void ScrollToLine(int32 LineIndex);
+
 	// UWidget interface
 	virtual TSharedRef<SWidget> RebuildWidget() override;
 	// End of UWidget interface
 
+	//~ Begin UVisual Interface
+	virtual void ReleaseSlateResources(bool bReleaseChildren) override;
+	//~ End UVisual Interface
+
 	TSharedPtr< SListView<UObject*> > MyListView;
+
+	virtual TSharedPtr< SListView<UObject*> > GetListViewWidget() const override;
+
+protected:
+
+	void HandleLinesIndexed(UJavascriptExtLineSource* InLineSource);
+	void HandleListScrolled(double InScrollOffset);
+	void HandleLineScrollbarScrolled(float InScrollOffsetFraction);
+
+	void SetLineWindow(int32 NewLineBase);
+	void UpdateLineScrollbar();
+
+	/** Number of items in view, the scroll offset of the list is in items as well */
+	virtual float GetNumVisibleLines() const;
+	int32 GetLineWindowSize() const;
+
+	/** Line shown at Items[0] while a line source is set */
+	int32 LineBase;
+
+	/** Scroll offset of the list inside Items, in rows */
+	double ListScrollOffset;
+
+	/** Number of lines the source had at the last update */
+	int32 LastNumLines;
+
+	bool bSettingScrollOffset;
+
+	EActiveTimerReturnType HandleFlushAppendedItems(double InCurrentTime, float InDeltaTime);
+
+	/** Ring buffer of appended items waiting for the next flush, holds at most ItemCapacity entries */
+	UPROPERTY(Transient)
+	TArray<UObject*> PendingItems;
+
+	int32 PendingHead;
+	int32 PendingNum;
+
+	TWeakPtr<FActiveTimerHandle> FlushTimerHandle;
+
+	TSharedPtr<SBox> ScrollBarBox;
+	TSharedPtr<SScrollBar> ListScrollBar;
+	TSharedPtr<SScrollBar> LineScrollBar;
 };
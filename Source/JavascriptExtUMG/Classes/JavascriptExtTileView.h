@@ -0,0 +1,64 @@
+// MIT License
+// 
+// Copyright (c) 2018-2019 Nuraga Wiswakarma
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#pragma once
+
+#include "JavascriptExtListView.h"
+#include "STileView.h"
+#include "JavascriptExtTileView.generated.h"
+
+class UJavascriptContext;
+
+/**
+* Allows thousands of items to be displayed in a grid.  Generates widgets dynamically for each visible tile.
+*/
+UCLASS(Experimental)
+class JAVASCRIPTEXTUMG_API UJavascriptExtTileView : public UJavascriptExtListView
+{
+	GENERATED_UCLASS_BODY()
+
+public:	
+	/** The width of each tile */
+	UPROPERTY(EditAnywhere, Category = Content)
+	float ItemWidth;
+
+	/** Sets the tile size and regenerates the visible tiles */
+	UFUNCTION(BlueprintCallable, Category = "Behavior")
+	void SetItemSize(float InItemWidth, float InItemHeight);
+
+	TSharedRef<ITableRow> HandleOnGenerateTile(UObject* Item, const TSharedRef< STableViewBase >& OwnerTable);
+
+	// UWidget interface
+	virtual TSharedRef<SWidget> RebuildWidget() override;
+	// End of UWidget interface
+
+	//~ Begin UVisual Interface
+	virtual void ReleaseSlateResources(bool bReleaseChildren) override;
+	//~ End UVisual Interface
+
+	TSharedPtr< STileView<UObject*> > MyTileView;
+
+protected:
+
+	virtual float GetNumVisibleLines() const override;
+};
@@ -28,6 +28,9 @@
 #include "JavascriptExtTreeView.generated.h"
 
 class UJavascriptContext;
+class UJavascriptExtGroupNode;
+class FJavascriptExtTraceBuffer;
+class FJavascriptExtCallbackRecorder;
 
 USTRUCT(BlueprintType)
 struct FJavascriptExtColumn
@@ -44,6 +47,27 @@ struct FJavascriptExtColumn
     UWidget* Widget;
 };
 
+UENUM(BlueprintType)
+enum class EJavascriptExtAggregate : uint8
+{
+	/** Adds up the values of every item in the subtree */
+	Sum,
+	/** Counts the items in the subtree with a non-zero value */
+	Count
+};
+
+USTRUCT(BlueprintType)
+struct FJavascriptExtAggregateColumn
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Javascript")
+	FName Id;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Javascript")
+	EJavascriptExtAggregate Aggregate;
+};
+
 /**
 * Allows thousands of items to be displayed in a list.  Generates widgets dynamically for each item.
 */
@@ -111,7 +135,19 @@ public:
 	UPROPERTY(BlueprintReadWrite, Transient, Category = "Javascript")
 	TArray<FJavascriptExtColumn> Columns;
 
-	/** Refreshes the list */
+	/** Property paths, such as a column id or "Asset.Type", that Items are nested into groups by */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Content)
+	TArray<FString> GroupBy;
+
+	/** Columns whose cells show natively maintained subtree aggregates */
+	UPROPERTY(BlueprintReadOnly, Transient, Category = "Javascript")
+	TArray<FJavascriptExtAggregateColumn> AggregateColumns;
+
+	/** Top level group nodes shown instead of Items while GroupBy is set */
+	UPROPERTY(BlueprintReadOnly, Transient, Category = "Javascript")
+	TArray<UObject*> GroupRoots;
+
+	/** Refreshes the list, regrouping Items first when they were replaced while GroupBy is set */
 	UFUNCTION(BlueprintCallable, Category = "Behavior")
 	void RequestTreeRefresh();
 
@@ -135,17 +171,112 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Javascript")
 	void SetSingleExpandedItem(UObject* InItem);
 
+	/** Resizes a column on the live header as well as in Columns */
 	UFUNCTION(BlueprintCallable, Category = "Javascript")
 	void SetColumnSize(FName ColumnId, float InSize);
 
+	/** Inserts a column at Index, or appends it when Index is out of range, without rebuilding the view */
+	UFUNCTION(BlueprintCallable, Category = "Javascript")
+	void AddColumn(FName ColumnId, float InSize, int32 Index = -1);
+
+	/** Removes a column, visible rows only drop its cells */
+	UFUNCTION(BlueprintCallable, Category = "Javascript")
+	void RemoveColumn(FName ColumnId);
+
+	/** Moves a column to Index, visible rows keep their generated cells */
+	UFUNCTION(BlueprintCallable, Category = "Javascript")
+	void MoveColumn(FName ColumnId, int32 Index);
+
 	UFUNCTION(BlueprintCallable, Category = "Javascript")
 	bool IsItemExpanded(UObject* InItem);
 
+	/** Groups Items by the given property paths, an empty array shows the flat Items again */
+	UFUNCTION(BlueprintCallable, Category = "Javascript")
+	void SetGroupBy(const TArray<FString>& InGroupBy);
+
+	/** Adds an item to Items and to its group without regrouping the rest, null and already grouped items are ignored */
+	UFUNCTION(BlueprintCallable, Category = "Javascript")
+	void AddItem(UObject* InItem);
+
+	/**
+	* Removes an item from Items and from its group, dropping groups that become empty.
+	* The item keeps its own aggregate values, so removing and adding it again moves it to its new group
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Javascript")
+	void RemoveItem(UObject* InItem);
+
+	UFUNCTION(BlueprintCallable, Category = "Javascript")
+	UJavascriptExtGroupNode* GetItemGroup(UObject* InItem) const;
+
+	/** Registers a column whose cells show a subtree aggregate read natively instead of calling OnGenerateRowEvent */
+	UFUNCTION(BlueprintCallable, Category = "Javascript")
+	void RegisterAggregateColumn(FName ColumnId, EJavascriptExtAggregate Aggregate);
+
+	/** Links an item to its parent for aggregation, moving its subtree totals to the new parent chain */
+	UFUNCTION(BlueprintCallable, Category = "Javascript")
+	void SetItemParent(UObject* InItem, UObject* InParent);
+
+	/** Sets the own value of an item and updates the totals of its parent chain */
+	UFUNCTION(BlueprintCallable, Category = "Javascript")
+	void SetAggregateValue(UObject* InItem, FName ColumnId, float Value);
+
+	/** Returns the cached aggregate of an item and everything below it */
+	UFUNCTION(BlueprintCallable, Category = "Javascript")
+	float GetAggregateValue(UObject* InItem, FName ColumnId) const;
+
+	/** Changes whenever any aggregate total changes, lets cells keep their text until then */
+	uint32 GetAggregateSerial() const { return AggregateSerial; }
+
+	/** Detaches an item from its parent and forgets its own values */
+	UFUNCTION(BlueprintCallable, Category = "Javascript")
+	void RemoveAggregateItem(UObject* InItem);
+
+	UFUNCTION(BlueprintCallable, Category = "Javascript")
+	void ClearAggregates();
+
+	int32 FindAggregateColumnIndex(FName ColumnId) const;
+
+	/** Starts recording timed spans of every view callback into a ring of Capacity spans */
+	UFUNCTION(BlueprintCallable, Category = "Javascript")
+	void StartTracing(int32 Capacity = 65536);
+
+	/** Stops recording, the recorded spans are kept for SaveTrace */
+	UFUNCTION(BlueprintCallable, Category = "Javascript")
+	void StopTracing();
+
+	/** Writes the recorded spans as Chrome trace JSON, loadable in chrome://tracing */
+	UFUNCTION(BlueprintCallable, Category = "Javascript")
+	bool SaveTrace(const FString& Filename);
+
+	/** Returns the trace buffer while tracing, null otherwise */
+	TSharedPtr<FJavascriptExtTraceBuffer, ESPMode::ThreadSafe> GetActiveTrace() const;
+
+	/** Starts recording callbacks and their results for UJavascriptExtCallbackReplay */
+	UFUNCTION(BlueprintCallable, Category = "Javascript")
+	void StartRecording();
+
+	/** Stops recording, the recorded callbacks are kept for SaveRecording */
+	UFUNCTION(BlueprintCallable, Category = "Javascript")
+	void StopRecording();
+
+	UFUNCTION(BlueprintCallable, Category = "Javascript")
+	bool SaveRecording(const FString& Filename);
+
+	/** Returns the callback recorder while recording, null otherwise */
+	FJavascriptExtCallbackRecorder* GetActiveRecorder() const;
+
+	/** Returns the live list or tree widget, STreeView is an SListView of the same items */
+	virtual TSharedPtr< SListView<UObject*> > GetListViewWidget() const;
+
+	/** Requests a refresh of the live tree or list after the items changed */
+	void RefreshItems();
+
 	TSharedRef<ITableRow> HandleOnGenerateRow(UObject* Item, const TSharedRef< STableViewBase >& OwnerTable);
 
 	void HandleOnGetChildren(UObject* Item, TArray<UObject*>& OutChildItems);
 	void HandleOnExpansionChanged(UObject* Item, bool bExpanded);
 	void HandleOnColumnRefreshed();
+	void HandleOnSelectionChanged(UObject* Item, ESelectInfo::Type SelectInfo);
 
 	// UWidget interface
 	virtual TSharedRef<SWidget> RebuildWidget() override;
@@ -174,6 +305,65 @@ public:
 
 protected:
 
+	bool GenerateColumnWidget(FJavascriptExtColumn& Column);
+	SHeaderRow::FColumn::FArguments MakeHeaderColumn(FJavascriptExtColumn& Column);
+	int32 FindColumnIndex(FName ColumnId) const;
+	int32 GetHeaderColumnIndex(int32 ColumnIndex) const;
+
+	void RegroupItems();
+
+	/** Whether ItemGroups holds exactly the items in Items */
+	bool AreItemsGrouped() const;
+	void AddToGroups(UObject* InItem);
+	void RemoveFromGroups(UObject* InItem);
+	const TArray<UObject*>* GetTreeItemsSource() const;
+
+	/** Records the columns and root items a refresh is about to show */
+	void RecordRefresh();
+
+	/** Records a refresh whose root items only changed at their ends */
+	void RecordRefreshSpliced(int32 NumRemovedFront, int32 NumRemovedBack, int32 NumAddedFront);
+
+	/** Top level groups by key */
+	TMap<FString, UJavascriptExtGroupNode*> RootGroups;
+
+	/** Innermost group of every grouped item */
+	TMap<UObject*, UJavascriptExtGroupNode*> ItemGroups;
+
+	struct FAggregateNode
+	{
+		UObject* Parent;
+		int32 NumChildren;
+
+		/** Removed while children still linked to it, erased once the last of them leaves */
+		bool bRemoved;
+
+		/** Own value of the item per aggregate column */
+		TArray<float> Values;
+
+		/** Aggregate of the item and its subtree per aggregate column */
+		TArray<double> Totals;
+	};
+
+	FAggregateNode& FindOrAddAggregateNode(UObject* InItem);
+	void AddToAggregateChain(UObject* InItem, int32 ColumnIndex, double Delta);
+	double GetAggregateContribution(int32 ColumnIndex, float Value) const;
+
+	/** Parents every grouped item and group node to its group for the aggregates */
+	void LinkGroupAggregates();
+
+	TMap<UObject*, FAggregateNode> AggregateNodes;
+
+	uint32 AggregateSerial;
+
+	TSharedPtr<FJavascriptExtTraceBuffer, ESPMode::ThreadSafe> TraceBuffer;
+
+	bool bTracing;
+
+	TSharedPtr<FJavascriptExtCallbackRecorder> Recorder;
+
+	bool bRecording;
+
 	TWeakPtr<SHeaderRow> HeaderRow;
 
 };
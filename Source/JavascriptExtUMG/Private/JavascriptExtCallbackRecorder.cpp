@@ -0,0 +1,180 @@
+// MIT License
+// 
+// Copyright (c) 2018-2019 Nuraga Wiswakarma
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "JavascriptExtCallbackRecorder.h"
+#include "JavascriptExtTreeView.h"
+#include "FileHelper.h"
+
+FJavascriptExtCallbackRecorder::FJavascriptExtCallbackRecorder()
+: bLastRootsValid(false)
+, NumRoots(INDEX_NONE)
+, FirstRoot(nullptr)
+, LastRoot(nullptr)
+{
+}
+
+void FJavascriptExtCallbackRecorder::RecordColumns(const TArray<FJavascriptExtColumn>& Columns)
+{
+	FString Header = TEXT("H");
+
+	for (const FJavascriptExtColumn& Column : Columns)
+	{
+		Header += FString::Printf(TEXT(" %s %f"), *Column.Id.ToString(), Column.Width);
+	}
+
+	if (Header != LastColumns)
+	{
+		Lines.Add(Header);
+		LastColumns = MoveTemp(Header);
+	}
+}
+
+void FJavascriptExtCallbackRecorder::RecordRoots(const TArray<UObject*>& Items)
+{
+	// Most refreshes only re-query the same roots, keep those to a marker
+	if (bLastRootsValid && Items == LastRoots)
+	{
+		Lines.Add(TEXT("F"));
+		return;
+	}
+
+	Lines.Add(TEXT("R") + GetItemIds(Items));
+	LastRoots = Items;
+	bLastRootsValid = true;
+	SetRoots(Items);
+}
+
+void FJavascriptExtCallbackRecorder::RecordRootsSpliced(const TArray<UObject*>& Items, int32 NumRemovedFront, int32 NumRemovedBack, int32 NumAddedFront)
+{
+	const int32 NumKept = NumRoots - NumRemovedFront - NumRemovedBack;
+	bool bSpliced = NumRoots != INDEX_NONE && NumKept >= 0 && NumAddedFront + NumKept <= Items.Num();
+
+	// Kept ends have to be the recorded ones, otherwise the roots were replaced outside a splice
+	if (bSpliced && NumKept > 0)
+	{
+		bSpliced = (NumRemovedFront || Items[NumAddedFront] == FirstRoot)
+			&& (NumRemovedBack || Items[NumAddedFront + NumKept - 1] == LastRoot);
+	}
+
+	if (!bSpliced)
+	{
+		RecordRoots(Items);
+		return;
+	}
+
+	if (NumRemovedFront || NumRemovedBack)
+	{
+		Lines.Add(FString::Printf(TEXT("X %d %d"), NumRemovedFront, NumRemovedBack));
+	}
+
+	if (NumAddedFront)
+	{
+		Lines.Add(TEXT("P") + GetItemIds(Items, 0, NumAddedFront));
+	}
+
+	if (NumAddedFront + NumKept < Items.Num())
+	{
+		Lines.Add(TEXT("A") + GetItemIds(Items, NumAddedFront + NumKept));
+	}
+
+	Lines.Add(TEXT("F"));
+
+	// Keeping LastRoots in sync would copy every root again, the next full refresh writes R instead
+	LastRoots.Empty();
+	bLastRootsValid = false;
+	SetRoots(Items);
+}
+
+void FJavascriptExtCallbackRecorder::SetRoots(const TArray<UObject*>& Items)
+{
+	NumRoots = Items.Num();
+	FirstRoot = Items.Num() ? Items[0] : nullptr;
+	LastRoot = Items.Num() ? Items.Last() : nullptr;
+}
+
+void FJavascriptExtCallbackRecorder::RecordGenerateRow(UObject* Item, FName Column)
+{
+	const int32 Id = GetItemId(Item);
+	Lines.Add(FString::Printf(TEXT("G %d %s"), Id, *Column.ToString()));
+}
+
+void FJavascriptExtCallbackRecorder::RecordChildren(UObject* Item, const TArray<UObject*>& Children)
+{
+	const int32 Id = GetItemId(Item);
+	const FString ChildIds = GetItemIds(Children);
+	Lines.Add(FString::Printf(TEXT("C %d%s"), Id, *ChildIds));
+}
+
+void FJavascriptExtCallbackRecorder::RecordExpansion(UObject* Item, bool bExpanded)
+{
+	const int32 Id = GetItemId(Item);
+	Lines.Add(FString::Printf(TEXT("E %d %d"), Id, bExpanded ? 1 : 0));
+}
+
+void FJavascriptExtCallbackRecorder::RecordSelection(UObject* Item)
+{
+	const int32 Id = GetItemId(Item);
+	Lines.Add(FString::Printf(TEXT("S %d"), Id));
+}
+
+void FJavascriptExtCallbackRecorder::RecordScroll(double ScrollOffset)
+{
+	Lines.Add(FString::Printf(TEXT("O %f"), ScrollOffset));
+}
+
+bool FJavascriptExtCallbackRecorder::SaveToFile(const FString& Filename) const
+{
+	return FFileHelper::SaveStringArrayToFile(Lines, *Filename);
+}
+
+int32 FJavascriptExtCallbackRecorder::GetItemId(UObject* Item)
+{
+	if (!Item)
+	{
+		return INDEX_NONE;
+	}
+
+	if (const int32* Id = ItemIds.Find(Item))
+	{
+		return *Id;
+	}
+
+	// Declare the item before the event that first mentions it
+	const int32 Id = ItemIds.Num();
+	ItemIds.Add(Item, Id);
+	Lines.Add(FString::Printf(TEXT("I %d %s"), Id, *Item->GetName()));
+	return Id;
+}
+
+FString FJavascriptExtCallbackRecorder::GetItemIds(const TArray<UObject*>& Items, int32 Start, int32 Count)
+{
+	const int32 End = Count == INDEX_NONE ? Items.Num() : FMath::Min(Start + Count, Items.Num());
+	FString Ids;
+
+	for (int32 Index = Start; Index < End; ++Index)
+	{
+		Ids += FString::Printf(TEXT(" %d"), GetItemId(Items[Index]));
+	}
+
+	return Ids;
+}
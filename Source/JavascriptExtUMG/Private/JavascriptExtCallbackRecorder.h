@@ -0,0 +1,88 @@
+// MIT License
+// 
+// Copyright (c) 2018-2019 Nuraga Wiswakarma
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FJavascriptExtColumn;
+
+/**
+* Records the stream of view callbacks and their results as text, one event per line:
+*
+*   I <Id> <Name>          first appearance of an item
+*   H <Column> <Width>...  columns, whenever they changed before a refresh
+*   R <Id>...              root items after a refresh
+*   X <Front> <Back>       roots dropped from both ends of the previous roots
+*   P <Id>...              roots inserted before the remaining ones
+*   A <Id>...              roots appended after the remaining ones
+*   F                      refresh of the current root items
+*   G <Id> <Column>        row or cell generated, Id is -1 for header cells
+*   C <Id> <Id>...         children returned for an item
+*   E <Id> <0|1>           expansion changed
+*   S <Id>                 selection changed, Id is -1 for a cleared selection
+*   O <Offset>             scroll offset changed, in rows or in items for tile views
+*/
+class FJavascriptExtCallbackRecorder
+{
+public:
+	FJavascriptExtCallbackRecorder();
+
+	void RecordColumns(const TArray<FJavascriptExtColumn>& Columns);
+	void RecordRoots(const TArray<UObject*>& Items);
+
+	/**
+	* Records roots that only changed at their ends, as X, P and A lines followed by F. Costs O(changed roots),
+	* so appending to a bounded list or shifting a line window does not write every root each frame
+	*/
+	void RecordRootsSpliced(const TArray<UObject*>& Items, int32 NumRemovedFront, int32 NumRemovedBack, int32 NumAddedFront);
+	void RecordGenerateRow(UObject* Item, FName Column);
+	void RecordChildren(UObject* Item, const TArray<UObject*>& Children);
+	void RecordExpansion(UObject* Item, bool bExpanded);
+	void RecordSelection(UObject* Item);
+	void RecordScroll(double ScrollOffset);
+
+	bool SaveToFile(const FString& Filename) const;
+
+private:
+	int32 GetItemId(UObject* Item);
+	FString GetItemIds(const TArray<UObject*>& Items, int32 Start = 0, int32 Count = INDEX_NONE);
+
+	TMap<TWeakObjectPtr<UObject>, int32> ItemIds;
+	FString LastColumns;
+
+	/** Roots of the last R line, only compared while no splice was recorded since */
+	TArray<UObject*> LastRoots;
+	bool bLastRootsValid;
+
+	/** Number of roots after the last recorded refresh, INDEX_NONE before the first one */
+	int32 NumRoots;
+
+	/** Ends of the roots after the last recorded refresh, only compared to spot roots replaced outside a splice */
+	const UObject* FirstRoot;
+	const UObject* LastRoot;
+
+	void SetRoots(const TArray<UObject*>& Items);
+
+	TArray<FString> Lines;
+};
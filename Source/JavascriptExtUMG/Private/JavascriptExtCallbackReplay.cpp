@@ -0,0 +1,421 @@
+// MIT License
+// 
+// Copyright (c) 2018-2019 Nuraga Wiswakarma
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "JavascriptExtCallbackReplay.h"
+#include "JavascriptExtTreeView.h"
+#include "JavascriptExtListView.h"
+#include "JavascriptExtUMG.h"
+#include "TextBlock.h"
+#include "FileHelper.h"
+#include "IConsoleManager.h"
+
+namespace JavascriptExtCallbackReplay
+{
+	/** Whether replaying an event of the given type ticks the view */
+	static bool IsTickingEvent(TCHAR Type)
+	{
+		switch (Type)
+		{
+		case TEXT('R'):
+		case TEXT('F'):
+		case TEXT('E'):
+		case TEXT('S'):
+		case TEXT('O'):
+			return true;
+
+		default:
+			return false;
+		}
+	}
+
+	/** Number of tokens a line of the given type needs, including the type itself */
+	static int32 GetMinTokens(TCHAR Type)
+	{
+		switch (Type)
+		{
+		case TEXT('I'):
+		case TEXT('G'):
+		case TEXT('E'):
+		case TEXT('X'):
+			return 3;
+
+		case TEXT('C'):
+		case TEXT('S'):
+		case TEXT('O'):
+			return 2;
+
+		default:
+			return 1;
+		}
+	}
+
+	static void ReplayCommand(const TArray<FString>& Args)
+	{
+		if (Args.Num() < 1)
+		{
+			UE_LOG(LogJavascriptExtUMG, Display, TEXT("Usage: JavascriptExtUMG.ReplayCallbacks <File> [Tree|List] [Width] [Height]"));
+			return;
+		}
+
+		UJavascriptExtCallbackReplay* Replay = NewObject<UJavascriptExtCallbackReplay>(GetTransientPackage());
+		if (!Replay->LoadRecording(Args[0]))
+		{
+			return;
+		}
+
+		const bool bList = Args.IsValidIndex(1) && Args[1] == TEXT("List");
+		const FVector2D ViewSize(
+			Args.IsValidIndex(2) ? FCString::Atof(*Args[2]) : 800.0f,
+			Args.IsValidIndex(3) ? FCString::Atof(*Args[3]) : 600.0f);
+
+		UJavascriptExtTreeView* View = bList
+			? NewObject<UJavascriptExtListView>(GetTransientPackage())
+			: NewObject<UJavascriptExtTreeView>(GetTransientPackage());
+
+		const FJavascriptExtReplayStats Stats = Replay->Replay(View, ViewSize);
+
+		UE_LOG(LogJavascriptExtUMG, Display, TEXT("Replayed %s: %d steps, %d rows generated (%d recorded), %d children queries, %.3f ms total, %.3f ms worst step"),
+			*Args[0], Stats.NumSteps, Stats.NumRowsGenerated, Stats.NumRowsRecorded, Stats.NumGetChildren, Stats.TotalSeconds * 1000.0f, Stats.MaxStepSeconds * 1000.0f);
+
+		View->ReleaseSlateResources(true);
+	}
+
+	static FAutoConsoleCommand ReplayCallbacksCommand(
+		TEXT("JavascriptExtUMG.ReplayCallbacks"),
+		TEXT("Replays a recorded callback stream into a native tree or list view and logs the timings. Usage: JavascriptExtUMG.ReplayCallbacks <File> [Tree|List] [Width] [Height]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&ReplayCommand));
+}
+
+bool UJavascriptExtCallbackReplay::LoadRecording(const FString& Filename)
+{
+	TArray<FString> Lines;
+	if (!FFileHelper::LoadFileToStringArray(Lines, *Filename))
+	{
+		UE_LOG(LogJavascriptExtUMG, Warning, TEXT("Unable to load callback recording %s"), *Filename);
+		return false;
+	}
+
+	Events.Reset();
+	ItemNames.Reset();
+
+	for (const FString& Line : Lines)
+	{
+		TArray<FString> Tokens;
+		if (Line.ParseIntoArrayWS(Tokens) == 0)
+		{
+			continue;
+		}
+
+		// A recording cut off while saving can end in a partial line, those are skipped like unknown ones
+		const TCHAR Type = Tokens[0][0];
+		if (Tokens.Num() < JavascriptExtCallbackReplay::GetMinTokens(Type))
+		{
+			UE_LOG(LogJavascriptExtUMG, Warning, TEXT("Skipping truncated callback recording line: %s"), *Line);
+			continue;
+		}
+
+		FReplayEvent Event;
+		Event.Type = Type;
+		Event.Item = Tokens.IsValidIndex(1) ? FCString::Atoi(*Tokens[1]) : INDEX_NONE;
+		Event.Value = 0;
+
+		switch (Event.Type)
+		{
+		case TEXT('I'):
+			// Ids are handed out in order of first appearance
+			ItemNames.Add(Tokens.IsValidIndex(2) ? Tokens[2] : FString());
+			continue;
+
+		case TEXT('H'):
+			for (int32 Index = 1; Index + 1 < Tokens.Num(); Index += 2)
+			{
+				Event.Columns.Add(FName(*Tokens[Index]));
+				Event.Widths.Add(FCString::Atof(*Tokens[Index + 1]));
+			}
+			break;
+
+		case TEXT('R'):
+		case TEXT('P'):
+		case TEXT('A'):
+			for (int32 Index = 1; Index < Tokens.Num(); ++Index)
+			{
+				Event.Items.Add(FCString::Atoi(*Tokens[Index]));
+			}
+			break;
+
+		case TEXT('C'):
+			for (int32 Index = 2; Index < Tokens.Num(); ++Index)
+			{
+				Event.Items.Add(FCString::Atoi(*Tokens[Index]));
+			}
+			break;
+
+		case TEXT('E'):
+		case TEXT('X'):
+			Event.Value = FCString::Atoi(*Tokens[2]);
+			break;
+
+		case TEXT('O'):
+			Event.Value = FCString::Atod(*Tokens[1]);
+			break;
+
+		case TEXT('F'):
+		case TEXT('G'):
+		case TEXT('S'):
+			break;
+
+		default:
+			UE_LOG(LogJavascriptExtUMG, Warning, TEXT("Skipping unknown callback recording line: %s"), *Line);
+			continue;
+		}
+
+		Events.Add(MoveTemp(Event));
+	}
+
+	return true;
+}
+
+FJavascriptExtReplayStats UJavascriptExtCallbackReplay::Replay(UJavascriptExtTreeView* View, FVector2D ViewSize)
+{
+	Stats = FJavascriptExtReplayStats();
+	CurrentTime = 0;
+
+	if (!View)
+	{
+		return Stats;
+	}
+
+	ReplayItems.Reset();
+	ReplayChildren.Reset();
+
+	for (int32 Id = 0; Id < ItemNames.Num(); ++Id)
+	{
+		UJavascriptExtReplayItem* Item = NewObject<UJavascriptExtReplayItem>(this);
+		Item->RecordedId = Id;
+		Item->RecordedName = ItemNames[Id];
+		ReplayItems.Add(Item);
+	}
+
+	// Native stubs stand in for script, so ProcessEvent never reaches a context
+	View->JavascriptContext = nullptr;
+	View->OnGenerateRowEvent.BindUFunction(this, GET_FUNCTION_NAME_CHECKED(UJavascriptExtCallbackReplay, HandleGenerateRow));
+	View->OnGetChildren.BindUFunction(this, GET_FUNCTION_NAME_CHECKED(UJavascriptExtCallbackReplay, HandleGetChildren));
+	View->Items.Reset();
+	View->Columns.Reset();
+	View->TakeWidget();
+
+	TSharedPtr< SListView<UObject*> > ListView = View->GetListViewWidget();
+
+	for (int32 EventIndex = 0; EventIndex < Events.Num(); ++EventIndex)
+	{
+		const FReplayEvent& Event = Events[EventIndex];
+
+		// Children are recorded while the view ticks, after the step that caused the tick
+		if (JavascriptExtCallbackReplay::IsTickingEvent(Event.Type))
+		{
+			ApplyChildren(EventIndex + 1);
+		}
+
+		switch (Event.Type)
+		{
+		case TEXT('H'):
+			SetColumns(View, Event);
+			break;
+
+		case TEXT('R'):
+			GetReplayItems(Event.Items, View->Items);
+			View->RefreshItems();
+			TickView(View, ViewSize);
+			break;
+
+		case TEXT('X'):
+			// Item holds the roots dropped from the front and Value those dropped from the back
+			View->Items.RemoveAt(0, FMath::Min(Event.Item, View->Items.Num()));
+			View->Items.SetNum(FMath::Max(View->Items.Num() - (int32)Event.Value, 0));
+			break;
+
+		case TEXT('P'):
+		{
+			TArray<UObject*> Inserted;
+			GetReplayItems(Event.Items, Inserted);
+			View->Items.Insert(Inserted, 0);
+			break;
+		}
+
+		case TEXT('A'):
+			for (int32 Id : Event.Items)
+			{
+				if (UObject* Item = GetReplayItem(Id))
+				{
+					View->Items.Add(Item);
+				}
+			}
+			break;
+
+		case TEXT('F'):
+			View->RefreshItems();
+			TickView(View, ViewSize);
+			break;
+
+		case TEXT('G'):
+			++Stats.NumRowsRecorded;
+			break;
+
+		case TEXT('C'):
+			// Already applied ahead of the step it was recorded in
+			break;
+
+		case TEXT('E'):
+			View->SetItemExpansion(GetReplayItem(Event.Item), Event.Value != 0);
+			TickView(View, ViewSize);
+			break;
+
+		case TEXT('S'):
+			if (ListView.IsValid())
+			{
+				if (UObject* Item = GetReplayItem(Event.Item))
+				{
+					ListView->SetSelection(Item);
+				}
+				else
+				{
+					ListView->ClearSelection();
+				}
+				TickView(View, ViewSize);
+			}
+			break;
+
+		case TEXT('O'):
+			if (ListView.IsValid())
+			{
+				ListView->SetScrollOffset((float)Event.Value);
+				TickView(View, ViewSize);
+			}
+			break;
+		}
+	}
+
+	return Stats;
+}
+
+UWidget* UJavascriptExtCallbackReplay::HandleGenerateRow(UObject* Object, FName Id, UJavascriptExtTreeView* Instance)
+{
+	++Stats.NumRowsGenerated;
+
+	auto Item = Cast<UJavascriptExtReplayItem>(Object);
+
+	UTextBlock* TextBlock = NewObject<UTextBlock>(this);
+	TextBlock->SetText(FText::FromString(Item ? Item->RecordedName : Id.ToString()));
+	return TextBlock;
+}
+
+void UJavascriptExtCallbackReplay::HandleGetChildren(UObject* Item, UJavascriptExtTreeView* Instance)
+{
+	++Stats.NumGetChildren;
+
+	auto ReplayItem = Cast<UJavascriptExtReplayItem>(Item);
+	const TArray<int32>* ChildIds = ReplayItem ? ReplayChildren.Find(ReplayItem->RecordedId) : nullptr;
+
+	if (ChildIds)
+	{
+		GetReplayItems(*ChildIds, Instance->Children);
+	}
+}
+
+void UJavascriptExtCallbackReplay::ApplyChildren(int32 FirstEventIndex)
+{
+	for (int32 EventIndex = FirstEventIndex; EventIndex < Events.Num() && !JavascriptExtCallbackReplay::IsTickingEvent(Events[EventIndex].Type); ++EventIndex)
+	{
+		if (Events[EventIndex].Type == TEXT('C'))
+		{
+			ReplayChildren.Add(Events[EventIndex].Item, Events[EventIndex].Items);
+		}
+	}
+}
+
+UObject* UJavascriptExtCallbackReplay::GetReplayItem(int32 Id) const
+{
+	return ReplayItems.IsValidIndex(Id) ? ReplayItems[Id] : nullptr;
+}
+
+void UJavascriptExtCallbackReplay::GetReplayItems(const TArray<int32>& Ids, TArray<UObject*>& OutItems) const
+{
+	OutItems.Reset(Ids.Num());
+
+	for (int32 Id : Ids)
+	{
+		if (UObject* Item = GetReplayItem(Id))
+		{
+			OutItems.Add(Item);
+		}
+	}
+}
+
+void UJavascriptExtCallbackReplay::SetColumns(UJavascriptExtTreeView* View, const FReplayEvent& Event)
+{
+	// Go through the live column calls so the replay exercises the same header updates
+	TArray<FName> RemovedColumns;
+
+	for (const FJavascriptExtColumn& Column : View->Columns)
+	{
+		if (!Event.Columns.Contains(Column.Id))
+		{
+			RemovedColumns.Add(Column.Id);
+		}
+	}
+
+	for (const FName& ColumnId : RemovedColumns)
+	{
+		View->RemoveColumn(ColumnId);
+	}
+
+	for (int32 Index = 0; Index < Event.Columns.Num(); ++Index)
+	{
+		View->AddColumn(Event.Columns[Index], Event.Widths[Index], Index);
+		View->MoveColumn(Event.Columns[Index], Index);
+	}
+}
+
+void UJavascriptExtCallbackReplay::TickView(UJavascriptExtTreeView* View, const FVector2D& ViewSize)
+{
+	TSharedPtr< SListView<UObject*> > ListView = View->GetListViewWidget();
+
+	if (!ListView.IsValid())
+	{
+		return;
+	}
+
+	const float DeltaTime = 1.0f / 60.0f;
+	const FGeometry Geometry = FGeometry::MakeRoot(ViewSize, FSlateLayoutTransform());
+
+	// Rows are regenerated in the table view tick, which arranges its panel from the prepassed sizes
+	const double StartTime = FPlatformTime::Seconds();
+	ListView->SlatePrepass(1.0f);
+	ListView->Tick(Geometry, CurrentTime, DeltaTime);
+	const float StepSeconds = FPlatformTime::Seconds() - StartTime;
+
+	++Stats.NumSteps;
+	Stats.TotalSeconds += StepSeconds;
+	Stats.MaxStepSeconds = FMath::Max(Stats.MaxStepSeconds, StepSeconds);
+	CurrentTime += DeltaTime;
+}
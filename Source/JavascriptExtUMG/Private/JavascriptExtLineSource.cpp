@@ -0,0 +1,378 @@
+// MIT License
+// 
+// Copyright (c) 2018-2019 Nuraga Wiswakarma
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "JavascriptExtLineSource.h"
+#include "JavascriptExtUMG.h"
+#include "PlatformFilemanager.h"
+#include "FileManager.h"
+#include "ScopeLock.h"
+#include "Ticker.h"
+#include "Async.h"
+
+namespace JavascriptExtLineSource
+{
+	/** Bytes scanned between cancellation checks and index publishes */
+	static const int64 ScanChunkSize = 1024 * 1024;
+
+	static void SplitFields(const FString& Line, TCHAR InDelimiter, TArray<FString>& OutFields)
+	{
+		FString Field;
+		bool bInQuotes = false;
+
+		for (int32 Index = 0; Index < Line.Len(); ++Index)
+		{
+			const TCHAR Char = Line[Index];
+
+			if (bInQuotes)
+			{
+				if (Char != TEXT('"'))
+				{
+					Field.AppendChar(Char);
+				}
+				else if (Index + 1 < Line.Len() && Line[Index + 1] == TEXT('"'))
+				{
+					// Escaped quote inside a quoted field
+					Field.AppendChar(Char);
+					++Index;
+				}
+				else
+				{
+					bInQuotes = false;
+				}
+			}
+			else if (Char == TEXT('"'))
+			{
+				bInQuotes = true;
+			}
+			else if (Char == InDelimiter)
+			{
+				OutFields.Add(Field);
+				Field.Reset();
+			}
+			else
+			{
+				Field.AppendChar(Char);
+			}
+		}
+
+		OutFields.Add(Field);
+	}
+}
+
+UJavascriptExtLineSource::UJavascriptExtLineSource(const FObjectInitializer& ObjectInitializer)
+: Super(ObjectInitializer)
+{
+	bFollowTail = false;
+	PollInterval = 0.25f;
+	IndexedBytes = 0;
+	bPartialTail = false;
+	NotifiedLines = 0;
+}
+
+bool UJavascriptExtLineSource::Open(const FString& InFilename)
+{
+	Close();
+
+	Filename = InFilename;
+
+	if (!MapFile())
+	{
+		Filename.Empty();
+		return false;
+	}
+
+	StartIndexing();
+
+	TickerHandle = FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UJavascriptExtLineSource::HandleTicker), PollInterval);
+	return true;
+}
+
+void UJavascriptExtLineSource::Close()
+{
+	if (TickerHandle.IsValid())
+	{
+		FTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+		TickerHandle.Reset();
+	}
+
+	if (IndexTask.IsValid())
+	{
+		bCancelIndexing = true;
+		IndexTask.Wait();
+		IndexTask = TFuture<void>();
+		bCancelIndexing = false;
+	}
+
+	MappedRegion.Reset();
+	MappedHandle.Reset();
+	Filename.Empty();
+	ResetIndex();
+
+	if (NotifiedLines != 0)
+	{
+		NotifiedLines = 0;
+		OnLinesIndexed.Broadcast(this);
+	}
+}
+
+void UJavascriptExtLineSource::BeginDestroy()
+{
+	OnLinesIndexed.Clear();
+	Close();
+
+	Super::BeginDestroy();
+}
+
+int32 UJavascriptExtLineSource::GetNumLines() const
+{
+	FScopeLock Lock(&IndexLock);
+	return LineStarts.Num();
+}
+
+bool UJavascriptExtLineSource::IsIndexing() const
+{
+	return IndexTask.IsValid() && !IndexTask.IsReady();
+}
+
+FString UJavascriptExtLineSource::GetLine(int32 LineIndex) const
+{
+	int64 Start, End;
+
+	if (!MappedRegion.IsValid() || !GetLineRange(LineIndex, Start, End))
+	{
+		return FString();
+	}
+
+	const uint8* Data = MappedRegion->GetMappedPtr();
+	End = FMath::Min(End, MappedRegion->GetMappedSize());
+
+	// Skip the UTF-8 byte order mark and strip the line break
+	if (Start == 0 && End >= 3 && Data[0] == 0xEF && Data[1] == 0xBB && Data[2] == 0xBF)
+	{
+		Start = 3;
+	}
+
+	while (End > Start && (Data[End - 1] == '\n' || Data[End - 1] == '\r'))
+	{
+		--End;
+	}
+
+	const int32 Length = (int32)FMath::Min<int64>(End - Start, MAX_int32);
+	FUTF8ToTCHAR Converter((const ANSICHAR*)(Data + Start), Length);
+	return FString(Converter.Length(), Converter.Get());
+}
+
+FString UJavascriptExtLineSource::GetField(int32 LineIndex, int32 FieldIndex) const
+{
+	TArray<FString> Fields;
+	GetFields(LineIndex, Fields);
+	return Fields.IsValidIndex(FieldIndex) ? Fields[FieldIndex] : FString();
+}
+
+void UJavascriptExtLineSource::GetFields(int32 LineIndex, TArray<FString>& OutFields) const
+{
+	OutFields.Reset();
+
+	FString Line = GetLine(LineIndex);
+
+	if (Delimiter.IsEmpty())
+	{
+		OutFields.Add(MoveTemp(Line));
+	}
+	else
+	{
+		JavascriptExtLineSource::SplitFields(Line, Delimiter[0], OutFields);
+	}
+}
+
+bool UJavascriptExtLineSource::MapFile()
+{
+	MappedRegion.Reset();
+	MappedHandle.Reset();
+
+	MappedHandle.Reset(FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*Filename));
+
+	if (!MappedHandle.IsValid())
+	{
+		UE_LOG(LogJavascriptExtUMG, Warning, TEXT("Unable to memory-map %s"), *Filename);
+		return false;
+	}
+
+	// Empty files have nothing to map yet, tail-follow picks them up once they grow
+	const int64 FileSize = MappedHandle->GetFileSize();
+
+	if (FileSize > 0)
+	{
+		MappedRegion.Reset(MappedHandle->MapRegion(0, FileSize));
+
+		if (!MappedRegion.IsValid())
+		{
+			UE_LOG(LogJavascriptExtUMG, Warning, TEXT("Unable to map %lld bytes of %s"), FileSize, *Filename);
+			MappedHandle.Reset();
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void UJavascriptExtLineSource::StartIndexing()
+{
+	if (!MappedRegion.IsValid())
+	{
+		return;
+	}
+
+	const uint8* Data = MappedRegion->GetMappedPtr();
+	const int64 Size = MappedRegion->GetMappedSize();
+
+	// An unterminated last line is still being written while following the tail
+	const bool bIndexPartialTail = !bFollowTail;
+
+	IndexTask = Async<void>(EAsyncExecution::ThreadPool, [this, Data, Size, bIndexPartialTail]()
+	{
+		IndexRange(Data, Size, bIndexPartialTail);
+	});
+}
+
+void UJavascriptExtLineSource::IndexRange(const uint8* Data, int64 Size, bool bIndexPartialTail)
+{
+	int64 LineStart;
+	bool bLineListed;
+	{
+		FScopeLock Lock(&IndexLock);
+
+		// Resume from the first line that was not terminated in the previous pass
+		bLineListed = bPartialTail;
+		LineStart = bPartialTail ? LineStarts.Last() : IndexedBytes;
+	}
+
+	TArray<int64> PendingStarts;
+	int64 Offset = LineStart;
+
+	while (Offset < Size && !bCancelIndexing)
+	{
+		const int64 ChunkEnd = FMath::Min(Offset + JavascriptExtLineSource::ScanChunkSize, Size);
+
+		for (; Offset < ChunkEnd; ++Offset)
+		{
+			if (Data[Offset] == '\n')
+			{
+				if (!bLineListed)
+				{
+					PendingStarts.Add(LineStart);
+				}
+				bLineListed = false;
+				LineStart = Offset + 1;
+			}
+		}
+
+		// Publish after every chunk so views can show lines while the rest is indexed
+		FScopeLock Lock(&IndexLock);
+		LineStarts.Append(PendingStarts);
+		PendingStarts.Reset();
+
+		if (!bLineListed)
+		{
+			IndexedBytes = LineStart;
+			bPartialTail = false;
+		}
+	}
+
+	if (!bCancelIndexing && bIndexPartialTail && LineStart < Size)
+	{
+		FScopeLock Lock(&IndexLock);
+
+		if (!bLineListed)
+		{
+			LineStarts.Add(LineStart);
+		}
+		IndexedBytes = Size;
+		bPartialTail = true;
+	}
+}
+
+void UJavascriptExtLineSource::ResetIndex()
+{
+	FScopeLock Lock(&IndexLock);
+	LineStarts.Empty();
+	IndexedBytes = 0;
+	bPartialTail = false;
+}
+
+bool UJavascriptExtLineSource::HandleTicker(float DeltaTime)
+{
+	if (bFollowTail && !IsIndexing())
+	{
+		const int64 FileSize = IFileManager::Get().FileSize(*Filename);
+		const int64 MappedSize = MappedRegion.IsValid() ? MappedRegion->GetMappedSize() : 0;
+
+		if (FileSize >= 0 && FileSize != MappedSize)
+		{
+			// A shrinking file was truncated or rotated, so the old offsets are meaningless
+			if (FileSize < MappedSize)
+			{
+				ResetIndex();
+			}
+
+			if (MapFile())
+			{
+				StartIndexing();
+			}
+		}
+	}
+
+	const int32 NumLines = GetNumLines();
+
+	if (NumLines != NotifiedLines)
+	{
+		NotifiedLines = NumLines;
+		OnLinesIndexed.Broadcast(this);
+	}
+
+	return true;
+}
+
+bool UJavascriptExtLineSource::GetLineRange(int32 LineIndex, int64& OutStart, int64& OutEnd) const
+{
+	FScopeLock Lock(&IndexLock);
+
+	if (!LineStarts.IsValidIndex(LineIndex))
+	{
+		return false;
+	}
+
+	OutStart = LineStarts[LineIndex];
+	OutEnd = LineStarts.IsValidIndex(LineIndex + 1) ? LineStarts[LineIndex + 1] : IndexedBytes;
+	return true;
+}
+
+FString UJavascriptExtLineItem::GetText() const
+{
+	return Source ? Source->GetLine(LineIndex) : FString();
+}
+
+FString UJavascriptExtLineItem::GetField(int32 FieldIndex) const
+{
+	return Source ? Source->GetField(LineIndex, FieldIndex) : FString();
+}
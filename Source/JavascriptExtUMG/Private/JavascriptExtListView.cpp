@@ -23,16 +23,34 @@
 
 #include "JavascriptExtListView.h"
 #include "JavascriptContext.h"
+#include "JavascriptExtLineSource.h"
+#include "JavascriptExtCallbackRecorder.h"
 
 UJavascriptExtListView::UJavascriptExtListView(const FObjectInitializer& ObjectInitializer)
 : Super(ObjectInitializer)
 {	
+	LineWindowSize = 256;
+	ItemCapacity = 0;
+	PendingHead = 0;
+	PendingNum = 0;
+	LineSource = nullptr;
+	LineBase = 0;
+	ListScrollOffset = 0;
+	LastNumLines = 0;
+	bSettingScrollOffset = false;
 }
 
 TSharedRef<SWidget> UJavascriptExtListView::RebuildWidget()
 {
     TSharedPtr<SHeaderRow> NewHeaderRow = GetHeaderRowWidget();
 	TSharedRef<SScrollBar> ExternalScrollbar = SNew(SScrollBar).Style(&ScrollBarStyle);
+
+	// A line source only keeps a window of rows in the list, so it shows its own scrollbar over all lines
+	ListScrollBar = ExternalScrollbar;
+	LineScrollBar = SNew(SScrollBar)
+		.Style(&ScrollBarStyle)
+		.OnUserScrolled_UObject(this, &UJavascriptExtListView::HandleLineScrollbarScrolled);
+
 	TSharedRef<SWidget> MyView = StaticCastSharedRef<SWidget>
 	(
 		SNew(SHorizontalBox)
@@ -55,15 +73,14 @@ TSharedRef<SWidget> UJavascriptExtListView::RebuildWidget()
 				return SNullWidget::NullWidget;
 			})
 			.OnGenerateRow(BIND_UOBJECT_DELEGATE(SListView< UObject* >::FOnGenerateRow, HandleOnGenerateRow))
-			.OnSelectionChanged_Lambda([this](UObject* Object, ESelectInfo::Type SelectInfo) {
-                OnSelectionChanged(Object, SelectInfo);
-			})
+			.OnSelectionChanged(BIND_UOBJECT_DELEGATE(SListView< UObject* >::FOnSelectionChanged, HandleOnSelectionChanged))
 			.OnMouseButtonClick_Lambda([this](UObject* Object) {
 				OnClick(Object);
 			})
 			.OnMouseButtonDoubleClick_Lambda([this](UObject* Object) {
 				OnDoubleClick(Object);
 			})
+			.OnListViewScrolled_UObject(this, &UJavascriptExtListView::HandleListScrolled)
 			.HeaderRow(NewHeaderRow)
 			.ExternalScrollbar(ExternalScrollbar)
 			//.OnContextMenuOpening(this, &SSocketManager::OnContextMenuOpening)
@@ -78,23 +95,39 @@ TSharedRef<SWidget> UJavascriptExtListView::RebuildWidget()
 		+SHorizontalBox::Slot()
 		.AutoWidth()
 		[
-			SNew(SBox)
+			SAssignNew(ScrollBarBox, SBox)
 			.WidthOverride(FOptionalSize(16))
 			[
-				ExternalScrollbar
+				LineSource ? LineScrollBar.ToSharedRef() : ExternalScrollbar
 			]
 		]
 	);
     HeaderRow = NewHeaderRow;
     HandleOnColumnRefreshed();
+	UpdateLineScrollbar();
 	return MyView;
 }
 
+void UJavascriptExtListView::ReleaseSlateResources(bool bReleaseChildren)
+{
+	Super::ReleaseSlateResources(bReleaseChildren);
+
+	MyListView.Reset();
+	ScrollBarBox.Reset();
+	ListScrollBar.Reset();
+	LineScrollBar.Reset();
+	FlushTimerHandle.Reset();
+
+	// The flush timer went away with the list, so apply what it was waiting for
+	FlushAppendedItems();
+}
+
 void UJavascriptExtListView::RequestListRefresh()
 {
 	if (MyListView.IsValid())
 	{
         HandleOnColumnRefreshed();
+		RecordRefresh();
 		MyListView->RequestListRefresh();
 	}	
 }
@@ -114,3 +147,368 @@ void UJavascriptExtListView::SetSelection(UObject* SoleSelectedItem)
 		MyListView->SetSelection(SoleSelectedItem);
 	}
 }
+
+TSharedPtr< SListView<UObject*> > UJavascriptExtListView::GetListViewWidget() const
+{
+	return MyListView;
+}
+
+void UJavascriptExtListView::AppendItem(UObject* Item)
+{
+	if (ItemCapacity > 0)
+	{
+		// Resizing the ring would reorder its entries, so apply what is queued first
+		if (PendingItems.Num() != ItemCapacity)
+		{
+			FlushAppendedItems();
+			PendingItems.SetNumZeroed(ItemCapacity);
+		}
+
+		// A full ring overwrites its oldest entry, which would be evicted on flush anyway
+		PendingItems[(PendingHead + PendingNum) % ItemCapacity] = Item;
+
+		if (PendingNum < ItemCapacity)
+		{
+			++PendingNum;
+		}
+		else
+		{
+			PendingHead = (PendingHead + 1) % ItemCapacity;
+		}
+	}
+	else
+	{
+		// Items queued while the list was bounded still sit in the ring, apply them before appending in order
+		if (PendingItems.Num() != PendingNum || PendingHead != 0)
+		{
+			FlushAppendedItems();
+			PendingItems.Reset();
+		}
+
+		PendingItems.Add(Item);
+		++PendingNum;
+	}
+
+	// Batch everything appended during this frame into a single refresh
+	if (MyListView.IsValid())
+	{
+		if (!FlushTimerHandle.IsValid())
+		{
+			FlushTimerHandle = MyListView->RegisterActiveTimer(0.0f, FWidgetActiveTimerDelegate::CreateUObject(this, &UJavascriptExtListView::HandleFlushAppendedItems));
+		}
+	}
+	else
+	{
+		FlushAppendedItems();
+	}
+}
+
+void UJavascriptExtListView::AppendItems(const TArray<UObject*>& InItems)
+{
+	for (UObject* Item : InItems)
+	{
+		AppendItem(Item);
+	}
+}
+
+void UJavascriptExtListView::FlushAppendedItems()
+{
+	if (PendingNum == 0)
+	{
+		return;
+	}
+
+	// Only stick to the end when the last row was already in view
+	const bool bWasAtBottom = ListScrollOffset + GetNumVisibleLines() >= Items.Num();
+	const int32 NumOldItems = Items.Num();
+
+	Items.Reserve(Items.Num() + PendingNum);
+
+	for (int32 Index = 0; Index < PendingNum; ++Index)
+	{
+		UObject*& PendingItem = PendingItems[(PendingHead + Index) % PendingItems.Num()];
+		Items.Add(PendingItem);
+		PendingItem = nullptr;
+	}
+
+	PendingHead = 0;
+	PendingNum = 0;
+
+	if (ItemCapacity <= 0)
+	{
+		PendingItems.Reset();
+	}
+
+	// Trimming only past a slack of an eighth of the capacity moves ItemCapacity entries per
+	// ItemCapacity / 8 appends, instead of shifting the whole array on every frame that appends anything
+	int32 NumEvicted = 0;
+
+	if (ItemCapacity > 0 && Items.Num() > ItemCapacity + FMath::Max(ItemCapacity / 8, 1))
+	{
+		NumEvicted = Items.Num() - ItemCapacity;
+		Items.RemoveAt(0, NumEvicted, false);
+	}
+
+	if (MyListView.IsValid())
+	{
+		if (bWasAtBottom)
+		{
+			MyListView->ScrollToBottom();
+		}
+		else if (NumEvicted)
+		{
+			// Keep the rows the user is looking at in place while the front is trimmed
+			ListScrollOffset = FMath::Max(ListScrollOffset - NumEvicted, 0.0);
+
+			TGuardValue<bool> Guard(bSettingScrollOffset, true);
+			MyListView->SetScrollOffset(ListScrollOffset);
+		}
+
+		// Rows are keyed by item, so the ones still in view are reused rather than regenerated
+		RecordRefreshSpliced(FMath::Min(NumEvicted, NumOldItems), 0, 0);
+		MyListView->RequestListRefresh();
+	}
+}
+
+EActiveTimerReturnType UJavascriptExtListView::HandleFlushAppendedItems(double InCurrentTime, float InDeltaTime)
+{
+	FlushAppendedItems();
+	return EActiveTimerReturnType::Stop;
+}
+
+void UJavascriptExtListView::SetLineSource(UJavascriptExtLineSource* InLineSource)
+{
+	if (LineSource)
+	{
+		LineSource->OnLinesIndexed.RemoveAll(this);
+	}
+
+	LineSource = InLineSource;
+	LineBase = 0;
+	ListScrollOffset = 0;
+	LastNumLines = 0;
+	Items.Empty();
+
+	if (MyListView.IsValid())
+	{
+		TGuardValue<bool> Guard(bSettingScrollOffset, true);
+		MyListView->SetScrollOffset(0);
+		RecordRefresh();
+		MyListView->RebuildList();
+	}
+
+	if (ScrollBarBox.IsValid())
+	{
+		ScrollBarBox->SetContent(LineSource ? LineScrollBar.ToSharedRef() : ListScrollBar.ToSharedRef());
+	}
+
+	if (LineSource)
+	{
+		LineSource->OnLinesIndexed.AddUObject(this, &UJavascriptExtListView::HandleLinesIndexed);
+		HandleLinesIndexed(LineSource);
+	}
+}
+
+void UJavascriptExtListView::ScrollToLine(int32 LineIndex)
+{
+	if (!LineSource)
+	{
+		return;
+	}
+
+	LineIndex = FMath::Clamp(LineIndex, 0, FMath::Max(LastNumLines - 1, 0));
+
+	SetLineWindow(LineIndex - GetLineWindowSize() / 4);
+	ListScrollOffset = LineIndex - LineBase;
+
+	if (MyListView.IsValid())
+	{
+		TGuardValue<bool> Guard(bSettingScrollOffset, true);
+		MyListView->SetScrollOffset(ListScrollOffset);
+	}
+
+	UpdateLineScrollbar();
+}
+
+void UJavascriptExtListView::HandleLinesIndexed(UJavascriptExtLineSource* InLineSource)
+{
+	const int32 NumLines = LineSource->GetNumLines();
+	const float NumVisibleLines = GetNumVisibleLines();
+
+	// Only follow appended lines while the last line was already in view
+	const bool bWasAtBottom = LineBase + ListScrollOffset + NumVisibleLines >= LastNumLines;
+	const bool bShrunk = NumLines < LastNumLines;
+	LastNumLines = NumLines;
+
+	if (LineSource->bFollowTail && bWasAtBottom)
+	{
+		ScrollToLine(NumLines - FMath::FloorToInt(NumVisibleLines));
+	}
+	else
+	{
+		SetLineWindow(LineBase);
+		UpdateLineScrollbar();
+	}
+
+	// A truncated file reuses line indices for different text
+	if (bShrunk && MyListView.IsValid())
+	{
+		MyListView->RebuildList();
+	}
+}
+
+void UJavascriptExtListView::HandleListScrolled(double InScrollOffset)
+{
+	if (FJavascriptExtCallbackRecorder* ActiveRecorder = GetActiveRecorder())
+	{
+		ActiveRecorder->RecordScroll(InScrollOffset);
+	}
+
+	if (bSettingScrollOffset)
+	{
+		return;
+	}
+
+	ListScrollOffset = InScrollOffset;
+
+	if (!LineSource)
+	{
+		return;
+	}
+
+	const int32 Margin = GetLineWindowSize() / 8;
+	const float NumVisibleLines = GetNumVisibleLines();
+	const bool bNearTop = LineBase > 0 && InScrollOffset < Margin;
+	const bool bNearBottom = LineBase + Items.Num() < LastNumLines && InScrollOffset + NumVisibleLines > Items.Num() - Margin;
+
+	if (bNearTop || bNearBottom)
+	{
+		// Recenter the window around the first visible line without moving it on screen
+		const double FirstLine = LineBase + InScrollOffset;
+		SetLineWindow(FMath::FloorToInt(FirstLine) - GetLineWindowSize() / 4);
+		ListScrollOffset = FirstLine - LineBase;
+
+		TGuardValue<bool> Guard(bSettingScrollOffset, true);
+		MyListView->SetScrollOffset(ListScrollOffset);
+	}
+
+	UpdateLineScrollbar();
+}
+
+void UJavascriptExtListView::HandleLineScrollbarScrolled(float InScrollOffsetFraction)
+{
+	ScrollToLine(FMath::FloorToInt(InScrollOffsetFraction * LastNumLines));
+}
+
+void UJavascriptExtListView::SetLineWindow(int32 NewLineBase)
+{
+	const int32 NumLines = LineSource->GetNumLines();
+	const int32 WindowSize = FMath::Min(GetLineWindowSize(), NumLines);
+	NewLineBase = FMath::Clamp(NewLineBase, 0, NumLines - WindowSize);
+
+	// Proxies of lines that stay inside the window keep their slot so their rows are not regenerated
+	TArray<UObject*> WindowItems;
+	WindowItems.SetNumZeroed(WindowSize);
+
+	TArray<UJavascriptExtLineItem*> FreeItems;
+
+	for (UObject* Item : Items)
+	{
+		auto LineItem = Cast<UJavascriptExtLineItem>(Item);
+		if (!LineItem)
+		{
+			continue;
+		}
+
+		const int32 Slot = LineItem->LineIndex - NewLineBase;
+
+		if (WindowItems.IsValidIndex(Slot) && !WindowItems[Slot])
+		{
+			WindowItems[Slot] = LineItem;
+		}
+		else
+		{
+			FreeItems.Add(LineItem);
+		}
+	}
+
+	bool bRecycledGeneratedRow = false;
+
+	for (int32 Slot = 0; Slot < WindowSize; ++Slot)
+	{
+		if (WindowItems[Slot])
+		{
+			continue;
+		}
+
+		UJavascriptExtLineItem* LineItem = nullptr;
+
+		if (FreeItems.Num())
+		{
+			LineItem = FreeItems.Pop(false);
+
+			// A proxy that still owns a row has to be regenerated for its new line
+			bRecycledGeneratedRow |= MyListView.IsValid() && MyListView->WidgetFromItem(LineItem).IsValid();
+		}
+		else
+		{
+			LineItem = NewObject<UJavascriptExtLineItem>(this);
+		}
+
+		LineItem->Source = LineSource;
+		LineItem->LineIndex = NewLineBase + Slot;
+		WindowItems[Slot] = LineItem;
+	}
+
+	// Proxies of the overlapping lines kept their order, only the ends of the window changed
+	const int32 OldLineBase = LineBase;
+	const int32 NumOldItems = Items.Num();
+	const int32 NumRemovedFront = FMath::Clamp(NewLineBase - OldLineBase, 0, NumOldItems);
+	const int32 NumRemovedBack = FMath::Clamp((OldLineBase + NumOldItems) - (NewLineBase + WindowSize), 0, NumOldItems - NumRemovedFront);
+	const int32 NumAddedFront = FMath::Clamp(OldLineBase - NewLineBase, 0, WindowSize);
+
+	Items = MoveTemp(WindowItems);
+	LineBase = NewLineBase;
+
+	if (MyListView.IsValid())
+	{
+		RecordRefreshSpliced(NumRemovedFront, NumRemovedBack, NumAddedFront);
+
+		if (bRecycledGeneratedRow)
+		{
+			MyListView->RebuildList();
+		}
+		else
+		{
+			MyListView->RequestListRefresh();
+		}
+	}
+}
+
+void UJavascriptExtListView::UpdateLineScrollbar()
+{
+	if (!LineSource || !LineScrollBar.IsValid())
+	{
+		return;
+	}
+
+	const float NumLines = FMath::Max(LastNumLines, 1);
+	LineScrollBar->SetState((LineBase + ListScrollOffset) / NumLines, FMath::Min(GetNumVisibleLines() / NumLines, 1.0f));
+}
+
+float UJavascriptExtListView::GetNumVisibleLines() const
+{
+	if (!MyListView.IsValid())
+	{
+		return 0.0f;
+	}
+
+	const float RowHeight = ItemHeight > 0.0f ? ItemHeight : 16.0f;
+	return MyListView->GetCachedGeometry().GetLocalSize().Y / RowHeight;
+}
+
+int32 UJavascriptExtListView::GetLineWindowSize() const
+{
+	// The window needs room for the visible rows plus a margin on both sides before it has to shift
+	return FMath::Max(LineWindowSize, FMath::CeilToInt(GetNumVisibleLines()) * 4);
+}
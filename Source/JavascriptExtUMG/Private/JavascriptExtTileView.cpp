@@ -0,0 +1,156 @@
+// MIT License
+// 
+// Copyright (c) 2018-2019 Nuraga Wiswakarma
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "JavascriptExtTileView.h"
+#include "JavascriptContext.h"
+#include "JavascriptExtTrace.h"
+#include "JavascriptExtCallbackRecorder.h"
+
+UJavascriptExtTileView::UJavascriptExtTileView(const FObjectInitializer& ObjectInitializer)
+: Super(ObjectInitializer)
+{	
+	ItemWidth = 128.0f;
+	ItemHeight = 128.0f;
+}
+
+TSharedRef<SWidget> UJavascriptExtTileView::RebuildWidget()
+{
+	TSharedRef<SScrollBar> ExternalScrollbar = SNew(SScrollBar).Style(&ScrollBarStyle);
+
+	// Same as the list, a line source only keeps a window of tiles and shows its own scrollbar over all lines
+	ListScrollBar = ExternalScrollbar;
+	LineScrollBar = SNew(SScrollBar)
+		.Style(&ScrollBarStyle)
+		.OnUserScrolled_UObject(this, &UJavascriptExtTileView::HandleLineScrollbarScrolled);
+
+	TSharedRef<SWidget> MyView = StaticCastSharedRef<SWidget>
+	(
+		SNew(SHorizontalBox)
+		+SHorizontalBox::Slot()
+		.FillWidth(1)
+		[
+			SAssignNew(MyTileView, STileView< UObject* >)
+			.SelectionMode(SelectionMode)
+			.ListItemsSource(&Items)
+			.ItemWidth_Lambda([this]() { return ItemWidth; })
+			.ItemHeight_Lambda([this]() { return ItemHeight; })
+			.OnContextMenuOpening_Lambda([this]() {
+				if (OnContextMenuOpening.IsBound())
+				{
+					auto Widget = OnContextMenuOpening.Execute(this);
+					if (Widget)
+					{
+						return Widget->TakeWidget();
+					}
+				}
+				return SNullWidget::NullWidget;
+			})
+			.OnGenerateTile(BIND_UOBJECT_DELEGATE(STileView< UObject* >::FOnGenerateRow, HandleOnGenerateTile))
+			.OnSelectionChanged(BIND_UOBJECT_DELEGATE(STileView< UObject* >::FOnSelectionChanged, HandleOnSelectionChanged))
+			.OnMouseButtonClick_Lambda([this](UObject* Object) {
+				OnClick(Object);
+			})
+			.OnMouseButtonDoubleClick_Lambda([this](UObject* Object) {
+				OnDoubleClick(Object);
+			})
+			.OnTileViewScrolled_UObject(this, &UJavascriptExtTileView::HandleListScrolled)
+			.ExternalScrollbar(ExternalScrollbar)
+		]
+		+SHorizontalBox::Slot()
+		.AutoWidth()
+		[
+			SAssignNew(ScrollBarBox, SBox)
+			.WidthOverride(FOptionalSize(16))
+			[
+				LineSource ? LineScrollBar.ToSharedRef() : ExternalScrollbar
+			]
+		]
+	);
+
+	// Share the tile view with the list interface so refresh and selection calls reach it
+	MyListView = MyTileView;
+	UpdateLineScrollbar();
+	return MyView;
+}
+
+TSharedRef<ITableRow> UJavascriptExtTileView::HandleOnGenerateTile(UObject* Item, const TSharedRef< STableViewBase >& OwnerTable)
+{
+	FJavascriptExtTraceScope TraceScope(GetActiveTrace(), TEXT("GenerateRow"), Item);
+
+	// Tiles have no header row, so the row event is always called without a column id
+	if (OnGenerateRowEvent.IsBound())
+	{
+		FJavascriptExtTraceScope EventTraceScope(GetActiveTrace(), TEXT("OnGenerateRowEvent"), Item);
+		UWidget* Widget = OnGenerateRowEvent.Execute(Item, FName(), this);
+
+		if (FJavascriptExtCallbackRecorder* ActiveRecorder = GetActiveRecorder())
+		{
+			ActiveRecorder->RecordGenerateRow(Item, NAME_None);
+		}
+		if (Widget != NULL)
+		{
+			auto GeneratedWidget = Widget->TakeWidget();
+			CachedRows.Add(Widget, GeneratedWidget);
+			return SNew(STableRow< UObject* >, OwnerTable).Style(&TableRowStyle)[GeneratedWidget];
+		}
+	}
+
+	// If a tile wasn't generated just create the default one, a simple text block of the item's name.
+	return SNew(STableRow< UObject* >, OwnerTable)
+		.Style(&TableRowStyle)
+		[
+			SNew(STextBlock).Text(Item ? FText::FromString(Item->GetName()) : FText::FromName(FName()))
+		];
+}
+
+void UJavascriptExtTileView::SetItemSize(float InItemWidth, float InItemHeight)
+{
+	ItemWidth = InItemWidth;
+	ItemHeight = InItemHeight;
+
+	if (MyTileView.IsValid())
+	{
+		MyTileView->RequestListRefresh();
+	}
+}
+
+float UJavascriptExtTileView::GetNumVisibleLines() const
+{
+	if (!MyTileView.IsValid())
+	{
+		return 0.0f;
+	}
+
+	// The tile view scrolls by items, a visible row of tiles holds as many items as fit across
+	const FVector2D Size = MyTileView->GetCachedGeometry().GetLocalSize();
+	const float NumItemsWide = FMath::Max(FMath::FloorToFloat(Size.X / FMath::Max(ItemWidth, 1.0f)), 1.0f);
+	return NumItemsWide * Size.Y / FMath::Max(ItemHeight, 1.0f);
+}
+
+void UJavascriptExtTileView::ReleaseSlateResources(bool bReleaseChildren)
+{
+	Super::ReleaseSlateResources(bReleaseChildren);
+
+	MyTileView.Reset();
+	MyListView.Reset();
+}
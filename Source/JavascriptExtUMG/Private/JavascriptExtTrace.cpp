@@ -0,0 +1,178 @@
+// MIT License
+// 
+// Copyright (c) 2018-2019 Nuraga Wiswakarma
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "JavascriptExtTrace.h"
+#include "JavascriptExtUMG.h"
+#include "FileHelper.h"
+
+namespace JavascriptExtTrace
+{
+	static FString EscapeJson(const FString& Value)
+	{
+		return Value.Replace(TEXT("\\"), TEXT("\\\\")).Replace(TEXT("\""), TEXT("\\\""));
+	}
+}
+
+FJavascriptExtTraceBuffer::FJavascriptExtTraceBuffer(int32 InCapacity)
+: NumClaimed(0)
+, NumDroppedSpans(0)
+, StartCycles(FPlatformTime::Cycles64())
+{
+	Events.AddZeroed(FMath::Max(InCapacity, 1));
+}
+
+FJavascriptExtTraceEvent* FJavascriptExtTraceBuffer::Claim(int64& OutIndex)
+{
+	// Nested spans keep their slots open, so a wrapped ring moves past them to the next committed slot
+	for (int32 Attempt = 0; Attempt < Events.Num(); ++Attempt)
+	{
+		OutIndex = FPlatformAtomics::InterlockedIncrement(&NumClaimed) - 1;
+
+		FJavascriptExtTraceEvent& Event = Events[OutIndex % Events.Num()];
+		if (FPlatformAtomics::InterlockedCompareExchange(&Event.bOpen, 1, 0) == 0)
+		{
+			FPlatformAtomics::InterlockedExchange(&Event.Sequence, 0);
+			return &Event;
+		}
+	}
+
+	FPlatformAtomics::InterlockedIncrement(&NumDroppedSpans);
+	return nullptr;
+}
+
+void FJavascriptExtTraceBuffer::Commit(FJavascriptExtTraceEvent& Event, int64 Index)
+{
+	FPlatformAtomics::InterlockedExchange(&Event.Sequence, Index + 1);
+	FPlatformAtomics::InterlockedExchange(&Event.bOpen, 0);
+}
+
+int32 FJavascriptExtTraceBuffer::Num() const
+{
+	return (int32)FMath::Min<int64>(NumClaimed, Events.Num());
+}
+
+int32 FJavascriptExtTraceBuffer::NumDropped() const
+{
+	return NumDroppedSpans;
+}
+
+bool FJavascriptExtTraceBuffer::SaveToFile(const FString& Filename) const
+{
+	// Order the committed slots by claim so the ring is written oldest first
+	TArray<const FJavascriptExtTraceEvent*> Committed;
+	Committed.Reserve(Events.Num());
+
+	for (const FJavascriptExtTraceEvent& Event : Events)
+	{
+		if (Event.Sequence != 0)
+		{
+			Committed.Add(&Event);
+		}
+	}
+
+	Committed.Sort([](const FJavascriptExtTraceEvent& A, const FJavascriptExtTraceEvent& B) { return A.Sequence < B.Sequence; });
+
+	if (NumDroppedSpans)
+	{
+		UE_LOG(LogJavascriptExtUMG, Warning, TEXT("%d trace spans were dropped because every slot was open, start tracing with a larger capacity"), NumDroppedSpans);
+	}
+
+	const double MicrosecondsPerCycle = FPlatformTime::GetSecondsPerCycle64() * 1000000.0;
+
+	FString Json = TEXT("{\"traceEvents\":[\n");
+
+	for (int32 Index = 0; Index < Committed.Num(); ++Index)
+	{
+		const FJavascriptExtTraceEvent& Event = *Committed[Index];
+
+		// Only the arguments the span was recorded with are written
+		TArray<FString> Args;
+
+		if (Event.Item != NAME_None)
+		{
+			Args.Add(FString::Printf(TEXT("\"item\":\"%s\""), *JavascriptExtTrace::EscapeJson(Event.Item.ToString())));
+		}
+
+		if (Event.Column != NAME_None)
+		{
+			Args.Add(FString::Printf(TEXT("\"column\":\"%s\""), *JavascriptExtTrace::EscapeJson(Event.Column.ToString())));
+		}
+
+		if (Event.Function != NAME_None)
+		{
+			Args.Add(FString::Printf(TEXT("\"function\":\"%s\""), *JavascriptExtTrace::EscapeJson(Event.Function.ToString())));
+		}
+
+		Json += FString::Printf(
+			TEXT("{\"name\":\"%s\",\"cat\":\"JavascriptExtUMG\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":0,\"tid\":%u,\"args\":{%s}}%s\n"),
+			Event.Name,
+			(Event.StartCycles - StartCycles) * MicrosecondsPerCycle,
+			(Event.EndCycles - Event.StartCycles) * MicrosecondsPerCycle,
+			Event.ThreadId,
+			*FString::Join(Args, TEXT(",")),
+			Index + 1 < Committed.Num() ? TEXT(",") : TEXT(""));
+	}
+
+	Json += TEXT("],\"displayTimeUnit\":\"ms\"}\n");
+
+	return FFileHelper::SaveStringToFile(Json, *Filename);
+}
+
+FJavascriptExtTraceScope::FJavascriptExtTraceScope(const TSharedPtr<FJavascriptExtTraceBuffer, ESPMode::ThreadSafe>& InBuffer, const TCHAR* Name, const UObject* Item, FName Column)
+: Buffer(InBuffer)
+, Event(nullptr)
+, Index(0)
+{
+	if (Buffer.IsValid())
+	{
+		Event = Buffer->Claim(Index);
+	}
+
+	if (Event)
+	{
+		Event->Name = Name;
+		Event->Item = Item ? Item->GetFName() : NAME_None;
+		Event->Column = Column;
+		Event->Function = NAME_None;
+		Event->ThreadId = FPlatformTLS::GetCurrentThreadId();
+		Event->StartCycles = FPlatformTime::Cycles64();
+	}
+}
+
+FJavascriptExtTraceScope::FJavascriptExtTraceScope(const TSharedPtr<FJavascriptExtTraceBuffer, ESPMode::ThreadSafe>& InBuffer, const TCHAR* Name, const UFunction* Function)
+: FJavascriptExtTraceScope(InBuffer, Name)
+{
+	if (Event)
+	{
+		Event->Function = Function ? Function->GetFName() : NAME_None;
+	}
+}
+
+FJavascriptExtTraceScope::~FJavascriptExtTraceScope()
+{
+	if (Event)
+	{
+		Event->EndCycles = FPlatformTime::Cycles64();
+		Buffer->Commit(*Event, Index);
+	}
+}
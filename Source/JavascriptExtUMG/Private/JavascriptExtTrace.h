@@ -0,0 +1,90 @@
+// MIT License
+// 
+// Copyright (c) 2018-2019 Nuraga Wiswakarma
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** A timed span recorded around a view callback */
+struct FJavascriptExtTraceEvent
+{
+	const TCHAR* Name;
+	FName Item;
+	FName Column;
+	FName Function;
+	uint64 StartCycles;
+	uint64 EndCycles;
+	uint32 ThreadId;
+
+	/** Index the slot was claimed with plus one, zero while the span is still open */
+	volatile int64 Sequence;
+
+	/** Non zero while a scope owns the slot, the ring skips it instead of overwriting an open span */
+	volatile int32 bOpen;
+};
+
+/**
+* Fixed size ring of trace spans. Slots are claimed with atomic operations, so recording never locks
+* and the latest spans overwrite the oldest committed ones. Slots of spans that are still open are skipped.
+*/
+class FJavascriptExtTraceBuffer
+{
+public:
+	explicit FJavascriptExtTraceBuffer(int32 InCapacity);
+
+	/** Claims the next free slot, the caller fills it and then calls Commit. Null when every slot is open */
+	FJavascriptExtTraceEvent* Claim(int64& OutIndex);
+	void Commit(FJavascriptExtTraceEvent& Event, int64 Index);
+
+	/** Writes the committed spans as Chrome trace event JSON, loadable in chrome://tracing */
+	bool SaveToFile(const FString& Filename) const;
+
+	int32 Num() const;
+
+	/** Number of spans dropped because every slot was still open */
+	int32 NumDropped() const;
+
+private:
+	TArray<FJavascriptExtTraceEvent> Events;
+	volatile int64 NumClaimed;
+	volatile int32 NumDroppedSpans;
+	uint64 StartCycles;
+};
+
+/** Records a span for the lifetime of the scope when tracing is active */
+class FJavascriptExtTraceScope
+{
+public:
+	FJavascriptExtTraceScope(const TSharedPtr<FJavascriptExtTraceBuffer, ESPMode::ThreadSafe>& InBuffer, const TCHAR* Name, const UObject* Item = nullptr, FName Column = NAME_None);
+
+	/** Records a span around a call into the given function */
+	FJavascriptExtTraceScope(const TSharedPtr<FJavascriptExtTraceBuffer, ESPMode::ThreadSafe>& InBuffer, const TCHAR* Name, const UFunction* Function);
+
+	~FJavascriptExtTraceScope();
+
+private:
+	/** Keeps the buffer alive if tracing is restarted from inside the traced callback */
+	TSharedPtr<FJavascriptExtTraceBuffer, ESPMode::ThreadSafe> Buffer;
+	FJavascriptExtTraceEvent* Event;
+	int64 Index;
+};
@@ -23,8 +23,67 @@
 
 #include "JavascriptExtTreeView.h"
 #include "JavascriptContext.h"
+#include "JavascriptExtGroupNode.h"
+#include "JavascriptExtUMG.h"
+#include "JavascriptExtTrace.h"
+#include "JavascriptExtCallbackRecorder.h"
 #include "SlateOptMacros.h"
 
+namespace JavascriptExtTreeView
+{
+	/** Exports the value at a dotted property path, following struct and object properties */
+	static FString GetGroupKey(UObject* Object, const FString& PropertyPath)
+	{
+		TArray<FString> PropertyNames;
+		PropertyPath.ParseIntoArray(PropertyNames, TEXT("."));
+
+		UStruct* Struct = Object->GetClass();
+		void* Container = Object;
+
+		for (int32 Index = 0; Index < PropertyNames.Num(); ++Index)
+		{
+			UProperty* Property = FindField<UProperty>(Struct, *PropertyNames[Index]);
+			if (!Property)
+			{
+				break;
+			}
+
+			void* Value = Property->ContainerPtrToValuePtr<void>(Container);
+
+			if (Index == PropertyNames.Num() - 1)
+			{
+				FString Key;
+				Property->ExportTextItem(Key, Value, nullptr, nullptr, PPF_None);
+				return Key;
+			}
+
+			if (auto StructProperty = Cast<UStructProperty>(Property))
+			{
+				Struct = StructProperty->Struct;
+				Container = Value;
+			}
+			else if (auto ObjectProperty = Cast<UObjectPropertyBase>(Property))
+			{
+				UObject* Inner = ObjectProperty->GetObjectPropertyValue(Value);
+				if (!Inner)
+				{
+					break;
+				}
+
+				Struct = Inner->GetClass();
+				Container = Inner;
+			}
+			else
+			{
+				break;
+			}
+		}
+
+		// Items missing the property end up together in an unnamed group
+		return FString();
+	}
+}
+
 UJavascriptExtTreeView::UJavascriptExtTreeView(const FObjectInitializer& ObjectInitializer)
 : Super(ObjectInitializer)
 {	
@@ -32,6 +91,10 @@ UJavascriptExtTreeView::UJavascriptExtTreeView(const FObjectInitializer& ObjectI
 
 	SelectionMode = ESelectionMode::Single;
 
+	bTracing = false;
+	bRecording = false;
+	AggregateSerial = 0;
+
 	HeaderRowStyle = FCoreStyle::Get().GetWidgetStyle<FHeaderRowStyle>("TableView.Header");
 	TableRowStyle = FCoreStyle::Get().GetWidgetStyle<FTableRowStyle>("TableView.Row");
 	ScrollBarStyle = FCoreStyle::Get().GetWidgetStyle<FScrollBarStyle>("ScrollBar");
@@ -47,36 +110,77 @@ TSharedPtr<SHeaderRow> UJavascriptExtTreeView::GetHeaderRowWidget()
 
 		for (auto& Column : Columns)
 		{
-            FName& ColumnId(Column.Id);
-
-			if (!Column.Widget)
+			if (GenerateColumnWidget(Column))
 			{
-				if (OnGenerateRowEvent.IsBound())
-				{
-					Column.Widget = OnGenerateRowEvent.Execute(nullptr, Column.Id, this);
-					ColumnWidgets.Add(Column.Widget);
-				}
+				HeaderRowWidget->AddColumn(MakeHeaderColumn(Column));
 			}
+		}
+	}
+	return HeaderRowWidget;
+}
 
-			if (!Column.Widget)
+bool UJavascriptExtTreeView::GenerateColumnWidget(FJavascriptExtColumn& Column)
+{
+	if (!Column.Widget)
+	{
+		if (OnGenerateRowEvent.IsBound())
+		{
+			FJavascriptExtTraceScope TraceScope(GetActiveTrace(), TEXT("OnGenerateRowEvent"), nullptr, Column.Id);
+			Column.Widget = OnGenerateRowEvent.Execute(nullptr, Column.Id, this);
+
+			if (FJavascriptExtCallbackRecorder* ActiveRecorder = GetActiveRecorder())
 			{
-				continue;
+				ActiveRecorder->RecordGenerateRow(nullptr, Column.Id);
 			}
+			ColumnWidgets.Add(Column.Widget);
+		}
+	}
 
-			HeaderRowWidget->AddColumn(
-				SHeaderRow::Column(Column.Id)
-				.FillWidth(Column.Width)
-				[
-					Column.Widget->TakeWidget()
-				]
-			);
+	return Column.Widget != nullptr;
+}
+
+SHeaderRow::FColumn::FArguments UJavascriptExtTreeView::MakeHeaderColumn(FJavascriptExtColumn& Column)
+{
+	return SHeaderRow::Column(Column.Id)
+		.FillWidth(Column.Width)
+		[
+			Column.Widget->TakeWidget()
+		];
+}
+
+int32 UJavascriptExtTreeView::FindColumnIndex(FName ColumnId) const
+{
+	return Columns.IndexOfByPredicate([ColumnId](const FJavascriptExtColumn& Column) { return Column.Id == ColumnId; });
+}
+
+int32 UJavascriptExtTreeView::GetHeaderColumnIndex(int32 ColumnIndex) const
+{
+	// Columns without a header widget were never added to the header row
+	int32 HeaderIndex = 0;
+
+	for (int32 Index = 0; Index < ColumnIndex; ++Index)
+	{
+		if (Columns[Index].Widget)
+		{
+			++HeaderIndex;
 		}
 	}
-	return HeaderRowWidget;
+
+	return HeaderIndex;
+}
+
+TSharedPtr< SListView<UObject*> > UJavascriptExtTreeView::GetListViewWidget() const
+{
+	return MyTreeView;
 }
 
 TSharedRef<SWidget> UJavascriptExtTreeView::RebuildWidget()
 {
+	if (GroupBy.Num())
+	{
+		RegroupItems();
+	}
+
     TSharedPtr<SHeaderRow> NewHeaderRow = GetHeaderRowWidget();
 	TSharedRef<SScrollBar> ExternalScrollbar = SNew(SScrollBar).Style(&ScrollBarStyle);
 	TSharedRef<SWidget> MyView = StaticCastSharedRef<SWidget>
@@ -87,7 +191,7 @@ TSharedRef<SWidget> UJavascriptExtTreeView::RebuildWidget()
 		[
 			SAssignNew(MyTreeView, STreeView< UObject* >)
 			.SelectionMode(SelectionMode)
-			.TreeItemsSource(&Items)
+			.TreeItemsSource(GetTreeItemsSource())
 			.OnGenerateRow(BIND_UOBJECT_DELEGATE(STreeView< UObject* >::FOnGenerateRow, HandleOnGenerateRow))
 			.OnGetChildren(BIND_UOBJECT_DELEGATE(STreeView< UObject* >::FOnGetChildren, HandleOnGetChildren))
 			.OnExpansionChanged(BIND_UOBJECT_DELEGATE(STreeView< UObject* >::FOnExpansionChanged, HandleOnExpansionChanged))
@@ -102,8 +206,12 @@ TSharedRef<SWidget> UJavascriptExtTreeView::RebuildWidget()
 				}
 				return SNullWidget::NullWidget;
 			})
-            .OnSelectionChanged_Lambda([this](UObject* Object, ESelectInfo::Type SelectInfo) {
-                OnSelectionChanged(Object, SelectInfo);
+            .OnSelectionChanged(BIND_UOBJECT_DELEGATE(STreeView< UObject* >::FOnSelectionChanged, HandleOnSelectionChanged))
+            .OnTreeViewScrolled_Lambda([this](double ScrollOffset) {
+				if (FJavascriptExtCallbackRecorder* ActiveRecorder = GetActiveRecorder())
+				{
+					ActiveRecorder->RecordScroll(ScrollOffset);
+				}
 			})
             .OnMouseButtonDoubleClick_Lambda([this](UObject* Object) {
 				OnDoubleClick(Object);
@@ -142,9 +250,25 @@ void UJavascriptExtTreeView::SetVisibility(ESlateVisibility InVisibility)
 
 void UJavascriptExtTreeView::ProcessEvent(UFunction* Function, void* Parms)
 {
-	if (JavascriptContext && JavascriptContext->CallProxyFunction(this, this, Function, Parms))
+	if (JavascriptContext)
 	{
-		return;
+		bool bHandled = false;
+
+		// Script also calls native UFUNCTIONs through here, only the proxy calls into script are traced
+		if (bTracing)
+		{
+			FJavascriptExtTraceScope TraceScope(TraceBuffer, TEXT("ProcessEvent"), Function);
+			bHandled = JavascriptContext->CallProxyFunction(this, this, Function, Parms);
+		}
+		else
+		{
+			bHandled = JavascriptContext->CallProxyFunction(this, this, Function, Parms);
+		}
+
+		if (bHandled)
+		{
+			return;
+		}
 	}
 
 	Super::ProcessEvent(Function, Parms);
@@ -152,9 +276,16 @@ void UJavascriptExtTreeView::ProcessEvent(UFunction* Function, void* Parms)
 
 void UJavascriptExtTreeView::RequestTreeRefresh()
 {
+	// Script usually assigns Items and then refreshes, which leaves the group nodes behind
+	if (GroupBy.Num() && !AreItemsGrouped())
+	{
+		RegroupItems();
+	}
+
 	if (MyTreeView.IsValid())
 	{
         HandleOnColumnRefreshed();
+		RecordRefresh();
 		MyTreeView->RequestTreeRefresh();
 	}	
 }
@@ -176,7 +307,10 @@ public:
 	// FSerializableObject interface
 	virtual void AddReferencedObjects(FReferenceCollector& Collector) override
 	{
-		Collector.AddReferencedObjects(Widgets);
+		for (auto& Cell : Cells)
+		{
+			Collector.AddReferencedObject(Cell.Value.Widget);
+		}
 		Collector.AddReferencedObject(Object);
 	}
 	// End of FSerializableObject interface
@@ -193,6 +327,25 @@ public:
 		TreeView = InArgs._TreeView;
 
 		SMultiColumnTableRow<UObject*>::Construct(FSuperRowType::FArguments().Style(InArgs._Style), InOwnerTableView);
+
+		TSharedPtr<SHeaderRow> HeaderRow = InOwnerTableView->GetHeaderRow();
+		if (HeaderRow.IsValid())
+		{
+			HeaderRow->OnColumnsChanged()->AddSP(this, &SJavascriptTableRow::HandleColumnsChanged);
+		}
+	}
+
+	/** Drops the cached cells of columns that were removed from the tree view */
+	void HandleColumnsChanged(const TSharedRef<SHeaderRow>& InHeaderRow)
+	{
+		for (auto It = Cells.CreateIterator(); It; ++It)
+		{
+			const FName ColumnId = It.Key();
+			if (!TreeView->Columns.ContainsByPredicate([ColumnId](const FJavascriptExtColumn& Column) { return Column.Id == ColumnId; }))
+			{
+				It.RemoveCurrent();
+			}
+		}
 	}
 
 public:
@@ -202,23 +355,72 @@ public:
 	BEGIN_SLATE_FUNCTION_BUILD_OPTIMIZATION
 	virtual TSharedRef<SWidget> GenerateWidgetForColumn(const FName& ColumnName) override
 	{
+		// Adding, removing or moving a column regenerates the row, so only new columns call into script
+		if (FCell* Cell = Cells.Find(ColumnName))
+		{
+			return Cell->Content;
+		}
+
+		// Aggregate cells show the cached subtree value without going through script,
+		// their text is only formatted again after some aggregate changed
+		if (TreeView->FindAggregateColumnIndex(ColumnName) != INDEX_NONE)
+		{
+			TWeakObjectPtr<UJavascriptExtTreeView> WeakTreeView(TreeView);
+			TWeakObjectPtr<UObject> WeakObject(Object);
+			FName AggregateId = ColumnName;
+			uint32 TextSerial = TreeView->GetAggregateSerial() - 1;
+			FText Text;
+
+			TSharedRef<SWidget> AggregateWidget = SNew(STextBlock)
+				.Text_Lambda([WeakTreeView, WeakObject, AggregateId, TextSerial, Text]() mutable {
+					if (!WeakTreeView.IsValid() || !WeakObject.IsValid())
+					{
+						return FText::GetEmpty();
+					}
+
+					if (TextSerial != WeakTreeView->GetAggregateSerial())
+					{
+						TextSerial = WeakTreeView->GetAggregateSerial();
+						Text = FText::AsNumber(WeakTreeView->GetAggregateValue(WeakObject.Get(), AggregateId));
+					}
+					return Text;
+				});
+
+			Cells.Add(ColumnName, FCell{ AggregateWidget, nullptr });
+			return AggregateWidget;
+		}
+
 		auto ColumnWidget = SNullWidget::NullWidget;
+		UWidget* Widget = nullptr;
 
 		if (TreeView->OnGenerateRowEvent.IsBound())
 		{
-			UWidget* Widget = TreeView->OnGenerateRowEvent.Execute(Object, ColumnName, TreeView);
+			FJavascriptExtTraceScope TraceScope(TreeView->GetActiveTrace(), TEXT("OnGenerateRowEvent"), Object, ColumnName);
+			Widget = TreeView->OnGenerateRowEvent.Execute(Object, ColumnName, TreeView);
+
+			if (FJavascriptExtCallbackRecorder* ActiveRecorder = TreeView->GetActiveRecorder())
+			{
+				ActiveRecorder->RecordGenerateRow(Object, ColumnName);
+			}
 
 			if (Widget)
 			{
 				ColumnWidget = Widget->TakeWidget();
-				Widgets.Add(Widget);
 			}
 		}
 
+		// Group nodes show their key and a live item count unless script generated a widget for them
+		UJavascriptExtGroupNode* Group = Cast<UJavascriptExtGroupNode>(Object);
+		if (!Widget && Group && ColumnName == TreeView->Columns[0].Id)
+		{
+			TWeakObjectPtr<UJavascriptExtGroupNode> WeakGroup(Group);
+			ColumnWidget = SNew(STextBlock).Text_Lambda([WeakGroup]() { return WeakGroup.IsValid() ? WeakGroup->GetDisplayText() : FText::GetEmpty(); });
+		}
+
 		if (TreeView->IsA(UJavascriptExtTreeView::StaticClass()) && ColumnName == TreeView->Columns[0].Id)
 		{
 			// The first column gets the tree expansion arrow for this row
-			return
+			ColumnWidget =
 				SNew(SHorizontalBox)
 				+ SHorizontalBox::Slot()
 				.VAlign(VAlign_Fill)
@@ -227,14 +429,19 @@ public:
 					ColumnWidget
 				];
 		}
-		else
-		{
-			return ColumnWidget;
-		}
+
+		Cells.Add(ColumnName, FCell{ ColumnWidget, Widget });
+		return ColumnWidget;
 	}
 	END_SLATE_FUNCTION_BUILD_OPTIMIZATION
 
-	TArray<UWidget*> Widgets;
+	struct FCell
+	{
+		TSharedRef<SWidget> Content;
+		UWidget* Widget;
+	};
+
+	TMap<FName, FCell> Cells;
 
 private:
 	UObject* Object;
@@ -243,6 +450,9 @@ private:
 
 TSharedRef<ITableRow> UJavascriptExtTreeView::HandleOnGenerateRow(UObject* Item, const TSharedRef< STableViewBase >& OwnerTable)
 {
+	// Covers the Slate row construction as well, column cells nest their own spans inside
+	FJavascriptExtTraceScope TraceScope(GetActiveTrace(), TEXT("GenerateRow"), Item);
+
 	// Call the user's delegate to see if they want to generate a custom widget bound to the data source.
 	if (OnGenerateRowEvent.IsBound())
 	{
@@ -252,7 +462,13 @@ TSharedRef<ITableRow> UJavascriptExtTreeView::HandleOnGenerateRow(UObject* Item,
 		}
 		else
 		{
+			FJavascriptExtTraceScope EventTraceScope(GetActiveTrace(), TEXT("OnGenerateRowEvent"), Item);
 			UWidget* Widget = OnGenerateRowEvent.Execute(Item, FName(), this);
+
+			if (FJavascriptExtCallbackRecorder* ActiveRecorder = GetActiveRecorder())
+			{
+				ActiveRecorder->RecordGenerateRow(Item, NAME_None);
+			}
 			if (Widget != NULL)
 			{
 				auto GeneratedWidget = Widget->TakeWidget();
@@ -262,6 +478,16 @@ TSharedRef<ITableRow> UJavascriptExtTreeView::HandleOnGenerateRow(UObject* Item,
 		}		
 	}
 
+	// Group nodes default to their key and a live item count
+	if (auto Group = Cast<UJavascriptExtGroupNode>(Item))
+	{
+		TWeakObjectPtr<UJavascriptExtGroupNode> WeakGroup(Group);
+		return SNew(STableRow< UObject* >, OwnerTable)
+			[
+				SNew(STextBlock).Text_Lambda([WeakGroup]() { return WeakGroup.IsValid() ? WeakGroup->GetDisplayText() : FText::GetEmpty(); })
+			];
+	}
+
 	// If a row wasn't generated just create the default one, a simple text block of the item's name.
 	return SNew(STableRow< UObject* >, OwnerTable)
 		[
@@ -272,22 +498,47 @@ TSharedRef<ITableRow> UJavascriptExtTreeView::HandleOnGenerateRow(UObject* Item,
 
 void UJavascriptExtTreeView::HandleOnGetChildren(UObject* Item, TArray<UObject*>& OutChildItems)
 {
+	// Group nodes are served natively, only grouped items themselves reach script
+	if (auto Group = Cast<UJavascriptExtGroupNode>(Item))
+	{
+		OutChildItems.Append(Group->Children);
+
+		if (FJavascriptExtCallbackRecorder* ActiveRecorder = GetActiveRecorder())
+		{
+			ActiveRecorder->RecordChildren(Item, Group->Children);
+		}
+		return;
+	}
+
 	if (OnGetChildren.IsBound())
 	{
+		FJavascriptExtTraceScope TraceScope(GetActiveTrace(), TEXT("OnGetChildren"), Item);
+
 		Children.Empty();
 
 		OnGetChildren.Execute(Item,this);
 		
 		OutChildItems.Append(Children);
 
+		if (FJavascriptExtCallbackRecorder* ActiveRecorder = GetActiveRecorder())
+		{
+			ActiveRecorder->RecordChildren(Item, Children);
+		}
+
 		Children.Empty();
 	}
 }
 
 void UJavascriptExtTreeView::HandleOnExpansionChanged(UObject* Item, bool bExpanded)
 {
+	if (FJavascriptExtCallbackRecorder* ActiveRecorder = GetActiveRecorder())
+	{
+		ActiveRecorder->RecordExpansion(Item, bExpanded);
+	}
+
 	if (OnExpansionChanged.IsBound())
 	{
+		FJavascriptExtTraceScope TraceScope(GetActiveTrace(), TEXT("OnExpansionChanged"), Item);
 		OnExpansionChanged.Execute(Item, bExpanded, this);
 	}
 }
@@ -300,11 +551,24 @@ void UJavascriptExtTreeView::HandleOnColumnRefreshed()
         {
             TSharedPtr<SHeaderRow> pHeaderRow = HeaderRow.Pin();
             for (auto& col : pHeaderRow->GetColumns())
+            {
+                FJavascriptExtTraceScope TraceScope(GetActiveTrace(), TEXT("OnColumnRefreshed"), nullptr, col.ColumnId);
                 OnColumnRefreshed.Execute(col.ColumnId, col.GetWidth(), this);
+            }
         }
 	}
 }
 
+void UJavascriptExtTreeView::HandleOnSelectionChanged(UObject* Item, ESelectInfo::Type SelectInfo)
+{
+	if (FJavascriptExtCallbackRecorder* ActiveRecorder = GetActiveRecorder())
+	{
+		ActiveRecorder->RecordSelection(Item);
+	}
+
+	OnSelectionChanged(Item, SelectInfo);
+}
+
 void UJavascriptExtTreeView::GetSelectedItems(TArray<UObject*>& OutItems)
 {
 	if (MyTreeView.IsValid())
@@ -347,6 +611,118 @@ void UJavascriptExtTreeView::SetColumnSize(FName ColumnId, float InSize)
             break;
         }
     }
+
+	TSharedPtr<SHeaderRow> pHeaderRow = HeaderRow.Pin();
+	if (pHeaderRow.IsValid())
+	{
+		// Row cells are bound to the header column width, so they follow it without being regenerated
+		pHeaderRow->SetColumnWidth(ColumnId, InSize);
+	}
+}
+
+void UJavascriptExtTreeView::AddColumn(FName ColumnId, float InSize, int32 Index)
+{
+	if (FindColumnIndex(ColumnId) != INDEX_NONE)
+	{
+		SetColumnSize(ColumnId, InSize);
+		return;
+	}
+
+	if (Index < 0 || Index > Columns.Num())
+	{
+		Index = Columns.Num();
+	}
+
+	FJavascriptExtColumn Column;
+	Column.Id = ColumnId;
+	Column.Width = InSize;
+	Column.Widget = nullptr;
+	Columns.Insert(Column, Index);
+
+	TSharedPtr<SHeaderRow> pHeaderRow = HeaderRow.Pin();
+	if (pHeaderRow.IsValid() && GenerateColumnWidget(Columns[Index]))
+	{
+		pHeaderRow->InsertColumn(MakeHeaderColumn(Columns[Index]), GetHeaderColumnIndex(Index));
+	}
+
+	// Rows generated without columns are single cell rows and have to be replaced
+	TSharedPtr< SListView<UObject*> > ListView = GetListViewWidget();
+	if (Columns.Num() == 1 && ListView.IsValid())
+	{
+		ListView->RebuildList();
+	}
+
+	HandleOnColumnRefreshed();
+}
+
+void UJavascriptExtTreeView::RemoveColumn(FName ColumnId)
+{
+	const int32 Index = FindColumnIndex(ColumnId);
+	if (Index == INDEX_NONE)
+	{
+		return;
+	}
+
+	// Remove it from Columns first so rows drop its cells when the header changes
+	ColumnWidgets.RemoveSingleSwap(Columns[Index].Widget);
+	Columns.RemoveAt(Index);
+
+	TSharedPtr<SHeaderRow> pHeaderRow = HeaderRow.Pin();
+	if (pHeaderRow.IsValid())
+	{
+		pHeaderRow->RemoveColumn(ColumnId);
+	}
+
+	TSharedPtr< SListView<UObject*> > ListView = GetListViewWidget();
+	if (Columns.Num() == 0 && ListView.IsValid())
+	{
+		ListView->RebuildList();
+	}
+
+	HandleOnColumnRefreshed();
+}
+
+void UJavascriptExtTreeView::MoveColumn(FName ColumnId, int32 Index)
+{
+	const int32 OldIndex = FindColumnIndex(ColumnId);
+	if (OldIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	Index = FMath::Clamp(Index, 0, Columns.Num() - 1);
+	if (Index == OldIndex)
+	{
+		return;
+	}
+
+	FJavascriptExtColumn Column = Columns[OldIndex];
+	TSharedPtr<SHeaderRow> pHeaderRow = HeaderRow.Pin();
+
+	// Dragging the header only resizes the live column, keep that width when it is recreated
+	if (pHeaderRow.IsValid())
+	{
+		for (const auto& HeaderColumn : pHeaderRow->GetColumns())
+		{
+			if (HeaderColumn.ColumnId == ColumnId)
+			{
+				Column.Width = HeaderColumn.GetWidth();
+				break;
+			}
+		}
+	}
+
+	Columns.RemoveAt(OldIndex);
+	Columns.Insert(Column, Index);
+
+	// The column stays in Columns throughout, so rows keep its cells while the header is reordered
+	if (pHeaderRow.IsValid() && Column.Widget)
+	{
+		pHeaderRow->RemoveColumn(ColumnId);
+		pHeaderRow->InsertColumn(MakeHeaderColumn(Columns[Index]), GetHeaderColumnIndex(Index));
+	}
+
+	HandleOnColumnRefreshed();
 }
 
 bool UJavascriptExtTreeView::IsItemExpanded(UObject* InItem)
@@ -354,11 +730,503 @@ bool UJavascriptExtTreeView::IsItemExpanded(UObject* InItem)
 	return MyTreeView.IsValid() && MyTreeView->IsItemExpanded(InItem);
 }
 
+void UJavascriptExtTreeView::SetGroupBy(const TArray<FString>& InGroupBy)
+{
+	GroupBy = InGroupBy;
+	RegroupItems();
+	RecordRefresh();
+
+	if (MyTreeView.IsValid())
+	{
+		MyTreeView->SetTreeItemsSource(GetTreeItemsSource());
+	}
+}
+
+void UJavascriptExtTreeView::AddItem(UObject* InItem)
+{
+	// A grouped item is already listed, adding it again would count it twice in its group
+	if (!InItem || ItemGroups.Contains(InItem))
+	{
+		return;
+	}
+
+	Items.Add(InItem);
+
+	if (GroupBy.Num())
+	{
+		AddToGroups(InItem);
+	}
+
+	RefreshItems();
+}
+
+void UJavascriptExtTreeView::RemoveItem(UObject* InItem)
+{
+	Items.RemoveSingle(InItem);
+
+	if (GroupBy.Num())
+	{
+		RemoveFromGroups(InItem);
+	}
+
+	RefreshItems();
+}
+
+UJavascriptExtGroupNode* UJavascriptExtTreeView::GetItemGroup(UObject* InItem) const
+{
+	return ItemGroups.FindRef(InItem);
+}
+
+void UJavascriptExtTreeView::RegroupItems()
+{
+	// The old group nodes go away, so their items are detached without touching the dropped totals
+	for (auto It = AggregateNodes.CreateIterator(); It; ++It)
+	{
+		if (It->Key->IsA(UJavascriptExtGroupNode::StaticClass()))
+		{
+			It.RemoveCurrent();
+		}
+		else if (It->Value.Parent && It->Value.Parent->IsA(UJavascriptExtGroupNode::StaticClass()))
+		{
+			It->Value.Parent = nullptr;
+		}
+	}
+
+	GroupRoots.Empty();
+	RootGroups.Empty();
+	ItemGroups.Empty();
+
+	if (GroupBy.Num())
+	{
+		for (UObject* Item : Items)
+		{
+			if (Item)
+			{
+				AddToGroups(Item);
+			}
+		}
+	}
+}
+
+bool UJavascriptExtTreeView::AreItemsGrouped() const
+{
+	int32 NumItems = 0;
+
+	for (UObject* Item : Items)
+	{
+		if (Item)
+		{
+			if (!ItemGroups.Contains(Item))
+			{
+				return false;
+			}
+			++NumItems;
+		}
+	}
+
+	return NumItems == ItemGroups.Num();
+}
+
+void UJavascriptExtTreeView::AddToGroups(UObject* InItem)
+{
+	if (!InItem || ItemGroups.Contains(InItem))
+	{
+		return;
+	}
+
+	UJavascriptExtGroupNode* Parent = nullptr;
+
+	for (int32 Depth = 0; Depth < GroupBy.Num(); ++Depth)
+	{
+		const FString Key = JavascriptExtTreeView::GetGroupKey(InItem, GroupBy[Depth]);
+		TMap<FString, UJavascriptExtGroupNode*>& Groups = Parent ? Parent->SubGroups : RootGroups;
+
+		UJavascriptExtGroupNode* Group = Groups.FindRef(Key);
+		if (!Group)
+		{
+			Group = NewObject<UJavascriptExtGroupNode>(this);
+			Group->Key = Key;
+			Group->GroupBy = GroupBy[Depth];
+			Group->Depth = Depth;
+			Group->Parent = Parent;
+
+			Groups.Add(Key, Group);
+			(Parent ? Parent->Children : GroupRoots).Add(Group);
+
+			if (AggregateColumns.Num())
+			{
+				SetItemParent(Group, Parent);
+			}
+		}
+
+		++Group->Count;
+		Parent = Group;
+	}
+
+	Parent->Children.Add(InItem);
+	ItemGroups.Add(InItem, Parent);
+
+	if (AggregateColumns.Num())
+	{
+		SetItemParent(InItem, Parent);
+	}
+}
+
+void UJavascriptExtTreeView::RemoveFromGroups(UObject* InItem)
+{
+	UJavascriptExtGroupNode* Group = nullptr;
+	if (!ItemGroups.RemoveAndCopyValue(InItem, Group))
+	{
+		return;
+	}
+
+	Group->Children.RemoveSingle(InItem);
+
+	// Only detach the item, its own values move along when it is added to another group
+	if (AggregateNodes.Contains(InItem))
+	{
+		SetItemParent(InItem, nullptr);
+	}
+
+	// Walk up the nesting, dropping groups that no longer hold any item
+	while (Group)
+	{
+		UJavascriptExtGroupNode* Parent = Group->Parent;
+
+		if (--Group->Count == 0)
+		{
+			(Parent ? Parent->SubGroups : RootGroups).Remove(Group->Key);
+			(Parent ? Parent->Children : GroupRoots).RemoveSingle(Group);
+			RemoveAggregateItem(Group);
+		}
+
+		Group = Parent;
+	}
+}
+
+void UJavascriptExtTreeView::RefreshItems()
+{
+	TSharedPtr< SListView<UObject*> > ListView = GetListViewWidget();
+	RecordRefresh();
+
+	if (MyTreeView.IsValid())
+	{
+		MyTreeView->RequestTreeRefresh();
+	}
+	else if (ListView.IsValid())
+	{
+		ListView->RequestListRefresh();
+	}
+}
+
+void UJavascriptExtTreeView::RegisterAggregateColumn(FName ColumnId, EJavascriptExtAggregate Aggregate)
+{
+	const int32 ColumnIndex = FindAggregateColumnIndex(ColumnId);
+
+	if (ColumnIndex != INDEX_NONE)
+	{
+		if (AggregateColumns[ColumnIndex].Aggregate != Aggregate)
+		{
+			UE_LOG(LogJavascriptExtUMG, Warning, TEXT("Aggregate column %s is already registered with a different aggregate"), *ColumnId.ToString());
+		}
+		return;
+	}
+
+	FJavascriptExtAggregateColumn AggregateColumn;
+	AggregateColumn.Id = ColumnId;
+	AggregateColumn.Aggregate = Aggregate;
+	AggregateColumns.Add(AggregateColumn);
+
+	for (auto& Pair : AggregateNodes)
+	{
+		Pair.Value.Values.AddZeroed();
+		Pair.Value.Totals.AddZeroed();
+	}
+
+	// Link the existing groups so their totals are maintained from now on
+	if (AggregateColumns.Num() == 1)
+	{
+		LinkGroupAggregates();
+	}
+}
+
+void UJavascriptExtTreeView::LinkGroupAggregates()
+{
+	for (auto& Pair : ItemGroups)
+	{
+		for (UJavascriptExtGroupNode* Group = Pair.Value; Group; Group = Group->Parent)
+		{
+			SetItemParent(Group, Group->Parent);
+		}
+		SetItemParent(Pair.Key, Pair.Value);
+	}
+}
+
+void UJavascriptExtTreeView::SetItemParent(UObject* InItem, UObject* InParent)
+{
+	if (!InItem)
+	{
+		return;
+	}
+
+	// Walk up from the new parent so a subtree is never linked below itself
+	for (UObject* Ancestor = InParent; Ancestor; )
+	{
+		if (Ancestor == InItem)
+		{
+			UE_LOG(LogJavascriptExtUMG, Warning, TEXT("Cannot parent %s below its own subtree"), *InItem->GetName());
+			return;
+		}
+
+		const FAggregateNode* AncestorNode = AggregateNodes.Find(Ancestor);
+		Ancestor = AncestorNode ? AncestorNode->Parent : nullptr;
+	}
+
+	// Adding the parent first keeps the item node from moving when the map grows
+	if (InParent)
+	{
+		FindOrAddAggregateNode(InParent);
+	}
+
+	FAggregateNode& Node = FindOrAddAggregateNode(InItem);
+	UObject* OldParent = Node.Parent;
+
+	if (OldParent == InParent)
+	{
+		return;
+	}
+
+	Node.Parent = InParent;
+	const TArray<double> Totals = Node.Totals;
+
+	for (int32 ColumnIndex = 0; ColumnIndex < Totals.Num(); ++ColumnIndex)
+	{
+		if (Totals[ColumnIndex] != 0)
+		{
+			AddToAggregateChain(OldParent, ColumnIndex, -Totals[ColumnIndex]);
+			AddToAggregateChain(InParent, ColumnIndex, Totals[ColumnIndex]);
+		}
+	}
+
+	if (OldParent)
+	{
+		FAggregateNode& OldParentNode = AggregateNodes.FindChecked(OldParent);
+
+		if (--OldParentNode.NumChildren == 0 && OldParentNode.bRemoved)
+		{
+			AggregateNodes.Remove(OldParent);
+		}
+	}
+
+	if (InParent)
+	{
+		AggregateNodes.FindChecked(InParent).NumChildren++;
+	}
+}
+
+void UJavascriptExtTreeView::SetAggregateValue(UObject* InItem, FName ColumnId, float Value)
+{
+	const int32 ColumnIndex = FindAggregateColumnIndex(ColumnId);
+
+	if (!InItem || ColumnIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	FAggregateNode& Node = FindOrAddAggregateNode(InItem);
+	const double Delta = GetAggregateContribution(ColumnIndex, Value) - GetAggregateContribution(ColumnIndex, Node.Values[ColumnIndex]);
+	Node.Values[ColumnIndex] = Value;
+
+	if (Delta != 0)
+	{
+		AddToAggregateChain(InItem, ColumnIndex, Delta);
+	}
+}
+
+float UJavascriptExtTreeView::GetAggregateValue(UObject* InItem, FName ColumnId) const
+{
+	const int32 ColumnIndex = FindAggregateColumnIndex(ColumnId);
+	const FAggregateNode* Node = AggregateNodes.Find(InItem);
+
+	return Node && ColumnIndex != INDEX_NONE ? (float)Node->Totals[ColumnIndex] : 0.0f;
+}
+
+void UJavascriptExtTreeView::RemoveAggregateItem(UObject* InItem)
+{
+	if (!AggregateNodes.Contains(InItem))
+	{
+		return;
+	}
+
+	SetItemParent(InItem, nullptr);
+
+	for (const auto& AggregateColumn : AggregateColumns)
+	{
+		SetAggregateValue(InItem, AggregateColumn.Id, 0.0f);
+	}
+
+	// Keep the node while children still link to it, so their totals reach it again if it is re-parented
+	FAggregateNode& Node = AggregateNodes.FindChecked(InItem);
+
+	if (Node.NumChildren == 0)
+	{
+		AggregateNodes.Remove(InItem);
+	}
+	else
+	{
+		Node.bRemoved = true;
+	}
+}
+
+void UJavascriptExtTreeView::ClearAggregates()
+{
+	AggregateNodes.Empty();
+	++AggregateSerial;
+
+	// AddToGroups only links groups it creates, so the surviving groups are linked again here
+	if (AggregateColumns.Num())
+	{
+		LinkGroupAggregates();
+	}
+}
+
+int32 UJavascriptExtTreeView::FindAggregateColumnIndex(FName ColumnId) const
+{
+	return AggregateColumns.IndexOfByPredicate([ColumnId](const FJavascriptExtAggregateColumn& AggregateColumn) { return AggregateColumn.Id == ColumnId; });
+}
+
+UJavascriptExtTreeView::FAggregateNode& UJavascriptExtTreeView::FindOrAddAggregateNode(UObject* InItem)
+{
+	FAggregateNode* Node = AggregateNodes.Find(InItem);
+
+	if (!Node)
+	{
+		Node = &AggregateNodes.Add(InItem);
+		Node->Parent = nullptr;
+		Node->NumChildren = 0;
+		Node->Values.AddZeroed(AggregateColumns.Num());
+		Node->Totals.AddZeroed(AggregateColumns.Num());
+	}
+
+	// Setting a value or linking a child brings a removed item back
+	Node->bRemoved = false;
+	return *Node;
+}
+
+void UJavascriptExtTreeView::AddToAggregateChain(UObject* InItem, int32 ColumnIndex, double Delta)
+{
+	++AggregateSerial;
+
+	// O(depth), only the item and its ancestors cover the changed subtree
+	for (FAggregateNode* Node = InItem ? AggregateNodes.Find(InItem) : nullptr; Node; )
+	{
+		Node->Totals[ColumnIndex] += Delta;
+		Node = Node->Parent ? AggregateNodes.Find(Node->Parent) : nullptr;
+	}
+}
+
+double UJavascriptExtTreeView::GetAggregateContribution(int32 ColumnIndex, float Value) const
+{
+	switch (AggregateColumns[ColumnIndex].Aggregate)
+	{
+	case EJavascriptExtAggregate::Count:
+		return Value != 0.0f ? 1.0 : 0.0;
+	default:
+		return Value;
+	}
+}
+
+void UJavascriptExtTreeView::StartTracing(int32 Capacity)
+{
+	TraceBuffer = MakeShareable(new FJavascriptExtTraceBuffer(Capacity));
+	bTracing = true;
+}
+
+void UJavascriptExtTreeView::StopTracing()
+{
+	bTracing = false;
+}
+
+bool UJavascriptExtTreeView::SaveTrace(const FString& Filename)
+{
+	if (!TraceBuffer.IsValid())
+	{
+		UE_LOG(LogJavascriptExtUMG, Warning, TEXT("No trace was recorded, call StartTracing first"));
+		return false;
+	}
+
+	return TraceBuffer->SaveToFile(Filename);
+}
+
+TSharedPtr<FJavascriptExtTraceBuffer, ESPMode::ThreadSafe> UJavascriptExtTreeView::GetActiveTrace() const
+{
+	if (!bTracing)
+	{
+		return nullptr;
+	}
+
+	return TraceBuffer;
+}
+
+void UJavascriptExtTreeView::StartRecording()
+{
+	Recorder = MakeShareable(new FJavascriptExtCallbackRecorder());
+	bRecording = true;
+
+	// The recording starts from the columns and items currently shown
+	RecordRefresh();
+}
+
+void UJavascriptExtTreeView::StopRecording()
+{
+	bRecording = false;
+}
+
+bool UJavascriptExtTreeView::SaveRecording(const FString& Filename)
+{
+	if (!Recorder.IsValid())
+	{
+		UE_LOG(LogJavascriptExtUMG, Warning, TEXT("No callbacks were recorded, call StartRecording first"));
+		return false;
+	}
+
+	return Recorder->SaveToFile(Filename);
+}
+
+FJavascriptExtCallbackRecorder* UJavascriptExtTreeView::GetActiveRecorder() const
+{
+	return bRecording ? Recorder.Get() : nullptr;
+}
+
+void UJavascriptExtTreeView::RecordRefresh()
+{
+	if (FJavascriptExtCallbackRecorder* ActiveRecorder = GetActiveRecorder())
+	{
+		ActiveRecorder->RecordColumns(Columns);
+		ActiveRecorder->RecordRoots(*GetTreeItemsSource());
+	}
+}
+
+void UJavascriptExtTreeView::RecordRefreshSpliced(int32 NumRemovedFront, int32 NumRemovedBack, int32 NumAddedFront)
+{
+	if (FJavascriptExtCallbackRecorder* ActiveRecorder = GetActiveRecorder())
+	{
+		ActiveRecorder->RecordColumns(Columns);
+		ActiveRecorder->RecordRootsSpliced(*GetTreeItemsSource(), NumRemovedFront, NumRemovedBack, NumAddedFront);
+	}
+}
+
+const TArray<UObject*>* UJavascriptExtTreeView::GetTreeItemsSource() const
+{
+	return GroupBy.Num() ? &GroupRoots : &Items;
+}
+
 void UJavascriptExtTreeView::AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector)
 {
 	auto This = static_cast<UJavascriptExtTreeView*>(InThis);
 
-	if (This->MyTreeView.IsValid())
+	// List and tile views never assign MyTreeView, so check the built widget instead
+	if (This->GetCachedWidget().IsValid())
 	{
 		for (auto It = This->CachedRows.CreateIterator(); It; ++It)
 		{
@@ -380,6 +1248,14 @@ void UJavascriptExtTreeView::AddReferencedObjects(UObject* InThis, FReferenceCol
 		This->CachedRows.Empty();
 	}
 
+	// Aggregated items stay alive until they are removed from the aggregates
+	for (auto& Pair : This->AggregateNodes)
+	{
+		auto Key = Pair.Key;
+		Collector.AddReferencedObject(Key, This);
+		Collector.AddReferencedObject(Pair.Value.Parent, This);
+	}
+
 	Super::AddReferencedObjects(This, Collector);
 }
 
@@ -25,6 +25,8 @@
 
 #define LOCTEXT_NAMESPACE "FJavascriptExtUMG"
 
+DEFINE_LOG_CATEGORY(LogJavascriptExtUMG);
+
 void FJavascriptExtUMG::StartupModule()
 {
 	// This code will execute after your module is loaded into memory; the exact timing is specified in the .uplugin file per-module
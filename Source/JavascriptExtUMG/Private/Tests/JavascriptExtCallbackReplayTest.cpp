@@ -0,0 +1,96 @@
+// MIT License
+// 
+// Copyright (c) 2018-2019 Nuraga Wiswakarma
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "JavascriptExtCallbackReplay.h"
+#include "JavascriptExtTreeView.h"
+#include "AutomationTest.h"
+#include "SlateApplication.h"
+#include "FileHelper.h"
+#include "Paths.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FJavascriptExtCallbackReplayTest, "JavascriptExtUMG.CallbackReplay", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FJavascriptExtCallbackReplayTest::RunTest(const FString& Parameters)
+{
+	// Ticking the view measures text, which needs the Slate application even under -nullrhi
+	if (!FSlateApplication::IsInitialized())
+	{
+		AddWarning(TEXT("Slate is not initialized, skipping the callback replay"));
+		return true;
+	}
+
+	// Header cell, two roots with the first expanded in the same frame, so its child row is only
+	// generated if the children recorded after the expansion are known when the view ticks.
+	// Then a bounded append evicts the first root and adds another one.
+	// The trailing partial scroll line stands in for a recording cut off while saving
+	const TArray<FString> Lines = {
+		TEXT("H Name 1.000000"),
+		TEXT("G -1 Name"),
+		TEXT("I 0 ItemA"),
+		TEXT("I 1 ItemB"),
+		TEXT("I 2 ItemC"),
+		TEXT("R 0 1"),
+		TEXT("E 0 1"),
+		TEXT("G 0 Name"),
+		TEXT("C 0 2"),
+		TEXT("G 2 Name"),
+		TEXT("C 2"),
+		TEXT("G 1 Name"),
+		TEXT("C 1"),
+		TEXT("I 3 ItemD"),
+		TEXT("X 1 0"),
+		TEXT("A 3"),
+		TEXT("F"),
+		TEXT("G 3 Name"),
+		TEXT("C 3"),
+		TEXT("O"),
+	};
+
+	const FString Filename = FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("JavascriptExtCallbackReplay.txt"));
+	if (!TestTrue(TEXT("Recording saved"), FFileHelper::SaveStringArrayToFile(Lines, *Filename)))
+	{
+		return false;
+	}
+
+	UJavascriptExtCallbackReplay* Replay = NewObject<UJavascriptExtCallbackReplay>(GetTransientPackage());
+	if (!TestTrue(TEXT("Recording loaded"), Replay->LoadRecording(Filename)))
+	{
+		return false;
+	}
+
+	UJavascriptExtTreeView* View = NewObject<UJavascriptExtTreeView>(GetTransientPackage());
+	const FJavascriptExtReplayStats Stats = Replay->Replay(View, FVector2D(800.0f, 600.0f));
+	View->ReleaseSlateResources(true);
+
+	// Header cell, both roots, the child of the expanded root and the appended root
+	TestEqual(TEXT("Rows recorded"), Stats.NumRowsRecorded, 5);
+	TestEqual(TEXT("Rows generated"), Stats.NumRowsGenerated, 5);
+	TestEqual(TEXT("Refresh, expansion and append steps"), Stats.NumSteps, 3);
+	TestTrue(TEXT("Children were queried for the roots"), Stats.NumGetChildren > 0);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -25,6 +25,8 @@
 
 #include "ModuleManager.h"
 
+DECLARE_LOG_CATEGORY_EXTERN(LogJavascriptExtUMG, Log, All);
+
 class FJavascriptExtUMG : public IModuleInterface
 {
 public: